@@ -10,139 +10,136 @@ CFAttributedString is not a "subclass" of CFString; that is, it does not respond
 Attributes are identified by key/value pairs stored in CFDictionaryRefs. Keys must be CFStrings, while the values are arbitrary CFTypeRefs.
 */
 
-#if !defined(__COREFOUNDATION_CFATTRIBUTEDSTRING__)
-#define __COREFOUNDATION_CFATTRIBUTEDSTRING__ 1
-
-#include <CoreFoundation/CFBase.h>
-#include <CoreFoundation/CFString.h>
-#include <CoreFoundation/CFDictionary.h>
-
-CF_IMPLICIT_BRIDGING_ENABLED
-CF_EXTERN_C_BEGIN
+package swift.corefoundation;
 
+import swift.corefoundation.CFBase;
 
 /* CFAttributedString comes in immutable and mutable flavors.
 */
-typedef const struct __CFAttributedString *CFAttributedStringRef;
-typedef struct __CFAttributedString *CFMutableAttributedStringRef;
+typedef CFAttributedStringRef = CFAttributedString;
+typedef CFMutableAttributedStringRef = CFAttributedString;
+
+/* Attributes are kept as runs, each pointing at one attribute dictionary.
+   Each Set/Remove call on a range splits and re-merges the runs it touches,
+   so applying many attributes to the same range is cheaper as one
+   CFAttributedStringSetAttributes with a combined dictionary than as a
+   series of CFAttributedStringSetAttribute calls, and a batch of edits
+   should be wrapped in CFAttributedStringBeginEditing/EndEditing. Reuse
+   the same CFDictionaryRef for runs that share attributes. When walking
+   the string, advance by the returned effectiveRange rather than per
+   character. */
+
+@:framework("CoreFoundation")
+extern class CFAttributedString {
 
 /*! @function CFAttributedStringGetTypeID
 Returns the type identifier of all CFAttributedString instances.
 */
-	@:c public static function  CFTypeID CFAttributedStringGetTypeID(void);
-
-
+	@:c public static function CFAttributedStringGetTypeID() :CFTypeID;
 
 /*** CFAttributedString ***/
 
 /*! @function CFAttributedStringCreate
 Creates an attributed string with the specified string and attributes (both copied).
 */
-	@:c public static function  CFAttributedStringRef CFAttributedStringCreate(CFAllocatorRef alloc, CFStringRef str, CFDictionaryRef attributes);
+	@:c public static function CFAttributedStringCreate(alloc:CFAllocatorRef, str:CFStringRef, attributes:CFDictionaryRef) :CFAttributedStringRef;
 
 /*! @function CFAttributedStringCreateWithSubstring
 Creates a sub-attributed string from the specified range. It's a programming error for range to specify characters outside the bounds of aStr.
 */
-	@:c public static function  CFAttributedStringRef CFAttributedStringCreateWithSubstring(CFAllocatorRef alloc, CFAttributedStringRef aStr, CFRange range);
+	@:c public static function CFAttributedStringCreateWithSubstring(alloc:CFAllocatorRef, aStr:CFAttributedStringRef, range:CFRange) :CFAttributedStringRef;
 
 /*! @function CFAttributedStringCreateCopy
 Creates an immutable attributed string copy.
 */
-	@:c public static function  CFAttributedStringRef CFAttributedStringCreateCopy(CFAllocatorRef alloc, CFAttributedStringRef aStr);
+	@:c public static function CFAttributedStringCreateCopy(alloc:CFAllocatorRef, aStr:CFAttributedStringRef) :CFAttributedStringRef;
 
 /*! @function CFAttributedStringGetString
 Returns the string for the attributed string. For performance reasons, this will often point at the backing store of the attributed string, and it might change if the attributed string is edited.  However, this is an implementation detail, and definitely not something that should be counted on.
 */
-	@:c public static function  CFStringRef CFAttributedStringGetString(CFAttributedStringRef aStr);
+	@:c public static function CFAttributedStringGetString(aStr:CFAttributedStringRef) :CFStringRef;
 
 /*! @function CFAttributedStringGetLength
 Returns the length of the attributed string in characters; same as CFStringGetLength(CFAttributedStringGetString(aStr))
 */
-	@:c public static function  CFIndex CFAttributedStringGetLength(CFAttributedStringRef aStr);
+	@:c public static function CFAttributedStringGetLength(aStr:CFAttributedStringRef) :CFIndex;
 
 /*! @function CFAttributedStringGetAttributes
 Returns the attributes at the specified location. If effectiveRange is not NULL, upon return *effectiveRange contains a range over which the exact same set of attributes apply. Note that for performance reasons, the returned effectiveRange is not necessarily the maximal range - for that, use CFAttributedStringGetAttributesAndLongestEffectiveRange().  It's a programming error for loc to specify a location outside the bounds of the attributed string.
 
 Note that the returned attribute dictionary might change in unpredictable ways from under the caller if the attributed string is edited after this call. If you wish to hang on to the dictionary long-term, you should make an actual copy of it rather than just retaining it.  Also, no assumptions should be made about the relationship of the actual CFDictionaryRef returned by this call and the dictionary originally used to set the attributes, other than the fact that the values stored in the dictionary will be identical (that is, ==) to those originally specified.
 */
-	@:c public static function  CFDictionaryRef CFAttributedStringGetAttributes(CFAttributedStringRef aStr, CFIndex loc, CFRange *effectiveRange);
+	@:c public static function CFAttributedStringGetAttributes(aStr:CFAttributedStringRef, loc:CFIndex, effectiveRange:CFRange) :CFDictionaryRef;
 
 /*! @function CFAttributedStringGetAttribute
 Returns the value of a single attribute at the specified location. If the specified attribute doesn't exist at the location, returns NULL. If effectiveRange is not NULL, upon return *effectiveRange contains a range over which the exact same attribute value applies. Note that for performance reasons, the returned effectiveRange is not necessarily the maximal range - for that, use CFAttributedStringGetAttributeAndLongestEffectiveRange(). It's a programming error for loc to specify a location outside the bounds of the attributed string.
 */
-	@:c public static function  CFTypeRef CFAttributedStringGetAttribute(CFAttributedStringRef aStr, CFIndex loc, CFStringRef attrName, CFRange *effectiveRange);
+	@:c public static function CFAttributedStringGetAttribute(aStr:CFAttributedStringRef, loc:CFIndex, attrName:CFStringRef, effectiveRange:CFRange) :CFTypeRef;
 
 /*! @function CFAttributedStringGetAttributesAndLongestEffectiveRange
 Returns the attributes at the specified location. If longestEffectiveRange is not NULL, upon return *longestEffectiveRange contains the maximal range within inRange over which the exact same set of attributes apply. The returned range is clipped to inRange. It's a programming error for loc or inRange to specify locations outside the bounds of the attributed string.
 */
-	@:c public static function  CFDictionaryRef CFAttributedStringGetAttributesAndLongestEffectiveRange(CFAttributedStringRef aStr, CFIndex loc, CFRange inRange, CFRange *longestEffectiveRange);
+	@:c public static function CFAttributedStringGetAttributesAndLongestEffectiveRange(aStr:CFAttributedStringRef, loc:CFIndex, inRange:CFRange, longestEffectiveRange:CFRange) :CFDictionaryRef;
 
 /*! @function CFAttributedStringGetAttributeAndLongestEffectiveRange
 Returns the value of a single attribute at the specified location. If longestEffectiveRange is not NULL, upon return *longestEffectiveRange contains the maximal range within inRange over which the exact same attribute value applies. The returned range is clipped to inRange. It's a programming error for loc or inRange to specify locations outside the bounds of the attributed string.
 */
-	@:c public static function  CFTypeRef CFAttributedStringGetAttributeAndLongestEffectiveRange(CFAttributedStringRef aStr, CFIndex loc, CFStringRef attrName, CFRange inRange, CFRange *longestEffectiveRange);
-
-
+	@:c public static function CFAttributedStringGetAttributeAndLongestEffectiveRange(aStr:CFAttributedStringRef, loc:CFIndex, attrName:CFStringRef, inRange:CFRange, longestEffectiveRange:CFRange) :CFTypeRef;
 
 /*** CFMutableAttributedString ***/
 
 /*! @function CFAttributedStringCreateMutableCopy
 Creates a mutable attributed string copy. maxLength, if not 0, is a hard bound on the length of the attributed string; exceeding this size limit during any editing operation is a programming error. If 0, there is no limit on the length.
 */
-	@:c public static function  CFMutableAttributedStringRef CFAttributedStringCreateMutableCopy(CFAllocatorRef alloc, CFIndex maxLength, CFAttributedStringRef aStr);
+	@:c public static function CFAttributedStringCreateMutableCopy(alloc:CFAllocatorRef, maxLength:CFIndex, aStr:CFAttributedStringRef) :CFMutableAttributedStringRef;
 
 /*! @function CFAttributedStringCreateMutable
 Creates a mutable empty attributed string. maxLength, if not 0, is a hard bound on the length of the attributed string; exceeding this size limit during any editing operation is a programming error. If 0, there is no limit on the length.
 */
-	@:c public static function  CFMutableAttributedStringRef CFAttributedStringCreateMutable(CFAllocatorRef alloc, CFIndex maxLength);
+	@:c public static function CFAttributedStringCreateMutable(alloc:CFAllocatorRef, maxLength:CFIndex) :CFMutableAttributedStringRef;
 
 /*! @function CFAttributedStringReplaceString
 Modifies the string for the attributed string, much like CFStringReplace().  It's an error for range to specify characters outside the bounds of aStr. 
 
 (Note: This function is a convenience on CFAttributedStringGetMutableString(); however, until CFAttributedStringGetMutableString() is implemented, it remains the only way to edit the string of the attributed string.)
 */
-	@:c public static function  void CFAttributedStringReplaceString(CFMutableAttributedStringRef aStr, CFRange range, CFStringRef replacement);
+	@:c public static function CFAttributedStringReplaceString(aStr:CFMutableAttributedStringRef, range:CFRange, replacement:CFStringRef) :Void;
 
 /*! @function CFAttributedStringGetMutableString
 Gets the string for the attributed string as a mutable string, allowing editing the character contents of the string as if it were an CFMutableString. Attributes corresponding to the edited range are appropriately modified. If, as a result of the edit, new characters are introduced into the string, they inherit the attributes of the first replaced character from range. If no existing characters are replaced by the edit, the new characters inherit the attributes of the character preceding range if it has any, otherwise of the character following range. If the initial string is empty, the attributes for the new characters are also empty.
 
 (Note: This function is not yet implemented and will return NULL except for toll-free bridged instances.)
 */
-	@:c public static function  CFMutableStringRef CFAttributedStringGetMutableString(CFMutableAttributedStringRef aStr);
+	@:c public static function CFAttributedStringGetMutableString(aStr:CFMutableAttributedStringRef) :CFMutableStringRef;
 
 /*! @function CFAttributedStringSetAttributes
 Sets the value of multiple attributes over the specified range, which should be valid. If clearOtherAttributes is false, existing attributes (which aren't being replaced) are left alone; otherwise they are cleared. The dictionary should be setup for "usual" CF type usage --- CFString keys, and arbitrary CFType values. Note that after this call, further mutations to the replacement dictionary argument by the caller will not affect the contents of the attributed string.
 */
-	@:c public static function  void CFAttributedStringSetAttributes(CFMutableAttributedStringRef aStr, CFRange range, CFDictionaryRef replacement, Boolean clearOtherAttributes);
+	@:c public static function CFAttributedStringSetAttributes(aStr:CFMutableAttributedStringRef, range:CFRange, replacement:CFDictionaryRef, clearOtherAttributes:Bool) :Void;
 
 /*! @function CFAttributedStringSetAttribute
 Sets the value of a single attribute over the specified range, which should be valid. value should not be NULL. 
 */
-	@:c public static function  void CFAttributedStringSetAttribute(CFMutableAttributedStringRef aStr, CFRange range, CFStringRef attrName, CFTypeRef value);
+	@:c public static function CFAttributedStringSetAttribute(aStr:CFMutableAttributedStringRef, range:CFRange, attrName:CFStringRef, value:CFTypeRef) :Void;
 
 /*! @function CFAttributedStringRemoveAttribute
 Removes the value of a single attribute over the specified range, which should be valid. It's OK for the attribute not the exist over the specified range.
 */
-	@:c public static function  void CFAttributedStringRemoveAttribute(CFMutableAttributedStringRef aStr, CFRange range, CFStringRef attrName);
+	@:c public static function CFAttributedStringRemoveAttribute(aStr:CFMutableAttributedStringRef, range:CFRange, attrName:CFStringRef) :Void;
 
 /*! @function CFAttributedStringReplaceAttributedString
 Replaces the attributed substring over the specified range with the attributed string specified in replacement. range should be valid. To delete a range of the attributed string, call CFAttributedStringReplaceString() with empty string and specified range. 
 */
-	@:c public static function  void CFAttributedStringReplaceAttributedString(CFMutableAttributedStringRef aStr, CFRange range, CFAttributedStringRef replacement);
+	@:c public static function CFAttributedStringReplaceAttributedString(aStr:CFMutableAttributedStringRef, range:CFRange, replacement:CFAttributedStringRef) :Void;
 
 /*! @function CFAttributedStringBeginEditing
 In cases where attributed string might do a bunch of work to assure self-consistency, CFAttributedStringBeginEditing/CFAttributedStringEndEditing allow disabling that to allow deferring and coalescing any work. It's a good idea to call these around a set of related mutation calls which don't require the string to be in consistent state in between. These calls can be nested. 
 */
-	@:c public static function  void CFAttributedStringBeginEditing(CFMutableAttributedStringRef aStr);
+	@:c public static function CFAttributedStringBeginEditing(aStr:CFMutableAttributedStringRef) :Void;
 
 /*! @function CFAttributedStringEndEditing
 In cases where attributed string might do a bunch of work to assure self-consistency, CFAttributedStringBeginEditing/CFAttributedStringEndEditing allow disabling that to allow deferring and coalescing any work. It's a good idea to call these around a set of related mutation calls which don't require the string to be in consistent state in between. These calls can be nested. 
 */
-	@:c public static function  void CFAttributedStringEndEditing(CFMutableAttributedStringRef aStr);
-
-
-CF_EXTERN_C_END
-CF_IMPLICIT_BRIDGING_DISABLED
-
-#endif /* ! __COREFOUNDATION_CFATTRIBUTEDSTRING__ */
+	@:c public static function CFAttributedStringEndEditing(aStr:CFMutableAttributedStringRef) :Void;
 
+}
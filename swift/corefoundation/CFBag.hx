@@ -0,0 +1,88 @@
+/*	CFBag.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFBagRef = CFBag;
+typedef CFMutableBagRef = CFBag;
+
+typedef CFBagRetainCallBack = CFAllocatorRef -> Dynamic -> Dynamic;
+typedef CFBagReleaseCallBack = CFAllocatorRef -> Dynamic -> Void;
+typedef CFBagCopyDescriptionCallBack = Dynamic -> CFStringRef;
+typedef CFBagEqualCallBack = Dynamic -> Dynamic -> Bool;
+typedef CFBagHashCallBack = Dynamic -> CFHashCode;
+typedef CFBagCallBacks = {
+    var version :CFIndex;
+    var retain :CFBagRetainCallBack;
+    var release :CFBagReleaseCallBack;
+    var copyDescription :CFBagCopyDescriptionCallBack;
+    var equal :CFBagEqualCallBack;
+    var hash :CFBagHashCallBack;
+}
+
+typedef CFBagApplierFunction = Dynamic -> Dynamic -> Void;
+
+/* A bag keeps one entry per distinct value together with its occurrence
+   count, so CFBagGetCountOfValue is a hash lookup and the storage grows
+   with the number of distinct values, not with the number of additions. */
+
+@:framework("CoreFoundation")
+extern class CFBag {
+
+	public static var kCFTypeBagCallBacks :CFBagCallBacks;
+	public static var kCFCopyStringBagCallBacks :CFBagCallBacks;
+
+	@:c public static function CFBagGetTypeID() :CFTypeID;
+
+/* Create an immutable bag from the `numValues' values of `values'. Duplicates
+   are folded into counts while the bag is built, which makes this the bulk
+   path for counting an array of values in one call. */
+
+	@:c public static function CFBagCreate(allocator:CFAllocatorRef, values:Array<Dynamic>, numValues:CFIndex, callBacks:CFBagCallBacks) :CFBagRef;
+
+	@:c public static function CFBagCreateCopy(allocator:CFAllocatorRef, theBag:CFBagRef) :CFBagRef;
+
+/* `capacity' is a hint for the number of distinct values; pass 0 for no
+   hint. */
+
+	@:c public static function CFBagCreateMutable(allocator:CFAllocatorRef, capacity:CFIndex, callBacks:CFBagCallBacks) :CFMutableBagRef;
+
+	@:c public static function CFBagCreateMutableCopy(allocator:CFAllocatorRef, capacity:CFIndex, theBag:CFBagRef) :CFMutableBagRef;
+
+/* Total number of values in the bag, duplicates included. */
+
+	@:c public static function CFBagGetCount(theBag:CFBagRef) :CFIndex;
+
+/* Number of times `value' occurs in the bag. */
+
+	@:c public static function CFBagGetCountOfValue(theBag:CFBagRef, value:Dynamic) :CFIndex;
+
+	@:c public static function CFBagContainsValue(theBag:CFBagRef, value:Dynamic) :Bool;
+
+	@:c public static function CFBagGetValue(theBag:CFBagRef, value:Dynamic) :Dynamic;
+
+	@:c public static function CFBagGetValueIfPresent(theBag:CFBagRef, candidate:Dynamic, value:Dynamic) :Bool;
+
+	@:c public static function CFBagGetValues(theBag:CFBagRef, values:Array<Dynamic>) :Void;
+
+/* The applier is called once per occurrence. To merge one bag into another,
+   apply CFBagAddValue of the destination over the source bag. */
+
+	@:c public static function CFBagApplyFunction(theBag:CFBagRef, applier:CFBagApplierFunction, context:Dynamic) :Void;
+
+	@:c public static function CFBagAddValue(theBag:CFMutableBagRef, value:Dynamic) :Void;
+
+	@:c public static function CFBagReplaceValue(theBag:CFMutableBagRef, value:Dynamic) :Void;
+
+	@:c public static function CFBagSetValue(theBag:CFMutableBagRef, value:Dynamic) :Void;
+
+/* Removes one occurrence of `value'. */
+
+	@:c public static function CFBagRemoveValue(theBag:CFMutableBagRef, value:Dynamic) :Void;
+
+	@:c public static function CFBagRemoveAllValues(theBag:CFMutableBagRef) :Void;
+
+}
@@ -0,0 +1,111 @@
+/*	CFBase.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+typedef CFIndex = Int;
+typedef CFOptionFlags = Int;
+typedef CFHashCode = Int;
+typedef CFTypeID = Int;
+typedef UInt8 = Int;
+typedef SInt32 = Int;
+typedef CFTypeRef = Dynamic;
+typedef CFStringRef = String;
+typedef CFMutableStringRef = Dynamic;
+typedef CFPropertyListRef = Dynamic;
+typedef CFAllocatorRef = CFAllocator;
+
+typedef CFRange = {
+    var location :CFIndex;
+    var length :CFIndex;
+}
+
+typedef CFAllocatorRetainCallBack = Dynamic -> Dynamic;
+typedef CFAllocatorReleaseCallBack = Dynamic -> Void;
+typedef CFAllocatorCopyDescriptionCallBack = Dynamic -> CFStringRef;
+typedef CFAllocatorAllocateCallBack = CFIndex -> CFOptionFlags -> Dynamic -> Dynamic;
+typedef CFAllocatorReallocateCallBack = Dynamic -> CFIndex -> CFOptionFlags -> Dynamic -> Dynamic;
+typedef CFAllocatorDeallocateCallBack = Dynamic -> Dynamic -> Void;
+typedef CFAllocatorPreferredSizeCallBack = CFIndex -> CFOptionFlags -> Dynamic -> CFIndex;
+typedef CFAllocatorContext = {
+    var version :CFIndex;
+    var info :Dynamic;
+    var retain :CFAllocatorRetainCallBack;
+    var release :CFAllocatorReleaseCallBack;
+    var copyDescription :CFAllocatorCopyDescriptionCallBack;
+    var allocate :CFAllocatorAllocateCallBack;
+    var reallocate :CFAllocatorReallocateCallBack;
+    var deallocate :CFAllocatorDeallocateCallBack;
+    var preferredSize :CFAllocatorPreferredSizeCallBack;
+}
+
+/* Every CF create function takes the allocator its object and storage come
+   from; NULL and kCFAllocatorDefault mean the current default allocator.
+
+   A custom allocator is built with CFAllocatorCreate from a context whose
+   callbacks receive `info' as their last argument. That is how an arena
+   (allocate bumps a pointer in `info', deallocate does nothing and the
+   whole arena is dropped at once), a size-class pool or a counting wrapper
+   around another allocator is plugged into CFArray, CFDictionary, CFString
+   and CFData creation. Objects allocated from an arena must not outlive
+   it, and must not be handed to code that may retain them past the reset. */
+
+@:framework("CoreFoundation")
+extern class CFAllocator {
+
+	//Constants
+	/* This is a synonym for NULL, if you'd rather use a named constant. */
+	public static var kCFAllocatorDefault :CFAllocatorRef;
+
+	/* Default system allocator; you rarely need to use this. */
+	public static var kCFAllocatorSystemDefault :CFAllocatorRef;
+
+	/* This allocator uses malloc(), realloc(), and free(). This should not be
+	   generally used; stick to kCFAllocatorDefault whenever possible. This
+	   allocator is useful as the "bytesDeallocator" in CFData or
+	   "contentsDeallocator" in CFString where the memory was obtained as a
+	   result of malloc() type functions. */
+	public static var kCFAllocatorMalloc :CFAllocatorRef;
+
+	/* This allocator explicitly uses the default malloc zone, returned by
+	   malloc_default_zone(). It should only be used when an object is
+	   safe to be allocated in non-scanned memory. */
+	public static var kCFAllocatorMallocZone :CFAllocatorRef;
+
+	/* Null allocator which does nothing and allocates no memory. This allocator
+	   is useful as the "bytesDeallocator" in CFData or "contentsDeallocator"
+	   in CFString where the memory should not be freed. */
+	public static var kCFAllocatorNull :CFAllocatorRef;
+
+	/* Special allocator argument to CFAllocatorCreate() which means
+	   "use the functions given in the context to allocate the allocator
+	   itself as well". */
+	public static var kCFAllocatorUseContext :CFAllocatorRef;
+
+	@:c public static function CFAllocatorGetTypeID() :CFTypeID;
+
+/* The default allocator is per thread; every create call on that thread
+   that passes NULL uses it. CFAllocatorSetDefault retains the new default
+   an extra time, so an allocator once installed as the default is never
+   freed, and a NULL argument is ignored. Install only long-lived
+   allocators this way; pass a short-lived arena explicitly to the create
+   calls instead. */
+
+	@:c public static function CFAllocatorSetDefault(allocator:CFAllocatorRef) :Void;
+
+	@:c public static function CFAllocatorGetDefault() :CFAllocatorRef;
+
+	@:c public static function CFAllocatorCreate(allocator:CFAllocatorRef, context:CFAllocatorContext) :CFAllocatorRef;
+
+	@:c public static function CFAllocatorAllocate(allocator:CFAllocatorRef, size:CFIndex, hint:CFOptionFlags) :Dynamic;
+
+	@:c public static function CFAllocatorReallocate(allocator:CFAllocatorRef, ptr:Dynamic, newsize:CFIndex, hint:CFOptionFlags) :Dynamic;
+
+	@:c public static function CFAllocatorDeallocate(allocator:CFAllocatorRef, ptr:Dynamic) :Void;
+
+	@:c public static function CFAllocatorGetPreferredSizeForSize(allocator:CFAllocatorRef, size:CFIndex, hint:CFOptionFlags) :CFIndex;
+
+	@:c public static function CFAllocatorGetContext(allocator:CFAllocatorRef, context:CFAllocatorContext) :Void;
+
+}
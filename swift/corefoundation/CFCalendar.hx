@@ -0,0 +1,90 @@
+/*	CFCalendar.h
+	Copyright (c) 2004-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+import swift.corefoundation.CFTimeZone;
+import haxe.extern.Rest;
+
+typedef CFCalendarRef = CFCalendar;
+typedef CFCalendarUnit = CFOptionFlags;
+
+@:framework("CoreFoundation")
+extern class CFCalendar {
+
+	//Constants
+	inline public static var kCFCalendarUnitEra = 2;
+	inline public static var kCFCalendarUnitYear = 4;
+	inline public static var kCFCalendarUnitMonth = 8;
+	inline public static var kCFCalendarUnitDay = 16;
+	inline public static var kCFCalendarUnitHour = 32;
+	inline public static var kCFCalendarUnitMinute = 64;
+	inline public static var kCFCalendarUnitSecond = 128;
+	inline public static var kCFCalendarUnitWeek = 256; /* CF_DEPRECATED(10_4, 10_7, 2_0, 5_0) */
+	inline public static var kCFCalendarUnitWeekday = 512;
+	inline public static var kCFCalendarUnitWeekdayOrdinal = 1024;
+	inline public static var kCFCalendarUnitQuarter = 2048; /* 10_6, 4_0 */
+	inline public static var kCFCalendarUnitWeekOfMonth = 4096; /* 10_7, 5_0 */
+	inline public static var kCFCalendarUnitWeekOfYear = 8192; /* 10_7, 5_0 */
+	inline public static var kCFCalendarUnitYearForWeekOfYear = 16384; /* 10_7, 5_0 */
+
+	inline public static var kCFCalendarComponentsWrap = 1;  // option for adding
+
+	@:c public static function CFCalendarGetTypeID() :CFTypeID;
+
+	@:c public static function CFCalendarCopyCurrent() :CFCalendarRef;
+
+	// Create a calendar.  The identifiers are the kCF*Calendar
+	// constants in CFLocale.h.
+	@:c public static function CFCalendarCreateWithIdentifier(allocator:CFAllocatorRef, identifier:CFStringRef) :CFCalendarRef;
+
+	// Returns the calendar's identifier.
+	@:c public static function CFCalendarGetIdentifier(calendar:CFCalendarRef) :CFStringRef;
+
+	@:c public static function CFCalendarCopyLocale(calendar:CFCalendarRef) :CFLocaleRef;
+
+	@:c public static function CFCalendarSetLocale(calendar:CFCalendarRef, locale:CFLocaleRef) :Void;
+
+	@:c public static function CFCalendarCopyTimeZone(calendar:CFCalendarRef) :CFTimeZoneRef;
+
+	@:c public static function CFCalendarSetTimeZone(calendar:CFCalendarRef, tz:CFTimeZoneRef) :Void;
+
+	@:c public static function CFCalendarGetFirstWeekday(calendar:CFCalendarRef) :CFIndex;
+
+	@:c public static function CFCalendarSetFirstWeekday(calendar:CFCalendarRef, wkdy:CFIndex) :Void;
+
+	@:c public static function CFCalendarGetMinimumDaysInFirstWeek(calendar:CFCalendarRef) :CFIndex;
+
+	@:c public static function CFCalendarSetMinimumDaysInFirstWeek(calendar:CFCalendarRef, mwd:CFIndex) :Void;
+
+	@:c public static function CFCalendarGetMinimumRangeOfUnit(calendar:CFCalendarRef, unit:CFCalendarUnit) :CFRange;
+
+	@:c public static function CFCalendarGetMaximumRangeOfUnit(calendar:CFCalendarRef, unit:CFCalendarUnit) :CFRange;
+
+	@:c public static function CFCalendarGetRangeOfUnit(calendar:CFCalendarRef, smallerUnit:CFCalendarUnit, biggerUnit:CFCalendarUnit, at:CFAbsoluteTime) :CFRange;
+
+	@:c public static function CFCalendarGetOrdinalityOfUnit(calendar:CFCalendarRef, smallerUnit:CFCalendarUnit, biggerUnit:CFCalendarUnit, at:CFAbsoluteTime) :CFIndex;
+
+	// Returns the start and length of the day, week, month... containing
+	// `at'. Every time inside [*startp, *startp + *tip) falls in the same
+	// unit, so bucketing a sorted run of times only has to call back into
+	// the calendar when a time leaves the current interval.
+	@:require(osx10_5)
+	@:require(ios2)
+	@:c public static function CFCalendarGetTimeRangeOfUnit(calendar:CFCalendarRef, unit:CFCalendarUnit, at:CFAbsoluteTime, startp:CFAbsoluteTime, tip:CFTimeInterval) :Bool;
+
+	// `componentDesc' lists one character per component ("yMdHms"), followed
+	// by one value (compose) or one pointer (decompose) per character. Ask
+	// only for the components that are needed; each one costs a field
+	// computation.
+	@:c public static function CFCalendarComposeAbsoluteTime(calendar:CFCalendarRef, /* out */ at:CFAbsoluteTime, componentDesc:String, rest:Rest<Dynamic>) :Bool;
+
+	@:c public static function CFCalendarDecomposeAbsoluteTime(calendar:CFCalendarRef, at:CFAbsoluteTime, componentDesc:String, rest:Rest<Dynamic>) :Bool;
+
+	@:c public static function CFCalendarAddComponents(calendar:CFCalendarRef, /* inout */ at:CFAbsoluteTime, options:CFOptionFlags, componentDesc:String, rest:Rest<Dynamic>) :Bool;
+
+	@:c public static function CFCalendarGetComponentDifference(calendar:CFCalendarRef, startingAT:CFAbsoluteTime, resultAT:CFAbsoluteTime, options:CFOptionFlags, componentDesc:String, rest:Rest<Dynamic>) :Bool;
+
+}
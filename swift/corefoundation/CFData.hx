@@ -0,0 +1,61 @@
+/*	CFData.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFDataRef = CFData;
+typedef CFMutableDataRef = CFData;
+typedef CFDataSearchFlags = CFOptionFlags;
+
+@:framework("CoreFoundation")
+extern class CFData {
+
+	//Constants
+	@:require(osx10_6) @:require(ios4) inline public static var kCFDataSearchBackwards = 1;
+	@:require(osx10_6) @:require(ios4) inline public static var kCFDataSearchAnchored = 2;
+
+	@:c public static function CFDataGetTypeID() :CFTypeID;
+
+	@:c public static function CFDataCreate(allocator:CFAllocatorRef, bytes:Dynamic, length:CFIndex) :CFDataRef;
+
+/* Wraps `bytes' without copying them. Pass kCFAllocatorNull as
+   bytesDeallocator to assure the bytes aren't freed. This is the way to
+   hand a received buffer, or a slice of one, to CF without a copy. */
+
+	@:c public static function CFDataCreateWithBytesNoCopy(allocator:CFAllocatorRef, bytes:Dynamic, length:CFIndex, bytesDeallocator:CFAllocatorRef) :CFDataRef;
+
+	@:c public static function CFDataCreateCopy(allocator:CFAllocatorRef, theData:CFDataRef) :CFDataRef;
+
+/* `capacity' is a hint; when the final size is known, or can be bounded,
+   pass it so that appending does not have to grow and copy the buffer. */
+
+	@:c public static function CFDataCreateMutable(allocator:CFAllocatorRef, capacity:CFIndex) :CFMutableDataRef;
+
+	@:c public static function CFDataCreateMutableCopy(allocator:CFAllocatorRef, capacity:CFIndex, theData:CFDataRef) :CFMutableDataRef;
+
+	@:c public static function CFDataGetLength(theData:CFDataRef) :CFIndex;
+
+	@:c public static function CFDataGetBytePtr(theData:CFDataRef) :Dynamic;
+
+	@:c public static function CFDataGetMutableBytePtr(theData:CFMutableDataRef) :Dynamic;
+
+	@:c public static function CFDataGetBytes(theData:CFDataRef, range:CFRange, buffer:Dynamic) :Void;
+
+	@:c public static function CFDataSetLength(theData:CFMutableDataRef, length:CFIndex) :Void;
+
+	@:c public static function CFDataIncreaseLength(theData:CFMutableDataRef, extraLength:CFIndex) :Void;
+
+	@:c public static function CFDataAppendBytes(theData:CFMutableDataRef, bytes:Dynamic, length:CFIndex) :Void;
+
+	@:c public static function CFDataReplaceBytes(theData:CFMutableDataRef, range:CFRange, newBytes:Dynamic, newLength:CFIndex) :Void;
+
+	@:c public static function CFDataDeleteBytes(theData:CFMutableDataRef, range:CFRange) :Void;
+
+	@:require(osx10_6)
+	@:require(ios4)
+	@:c public static function CFDataFind(theData:CFDataRef, dataToFind:CFDataRef, searchRange:CFRange, compareOptions:CFDataSearchFlags) :CFRange;
+
+}
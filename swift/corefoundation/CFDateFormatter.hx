@@ -0,0 +1,130 @@
+/*	CFDateFormatter.h
+	Copyright (c) 2003-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFDateFormatterRef = CFDateFormatter;
+
+@:framework("CoreFoundation")
+extern enum CFDateFormatterStyle {	// date and time format styles
+	kCFDateFormatterNoStyle;
+	kCFDateFormatterShortStyle;
+	kCFDateFormatterMediumStyle;
+	kCFDateFormatterLongStyle;
+	kCFDateFormatterFullStyle;
+}
+
+// The exact formatted result for these date and time styles depends on the
+// locale, but generally:
+//     Short is completely numeric, such as "12/13/52" or "3:30pm"
+//     Medium is longer, such as "Jan 12, 1952"
+//     Long is longer, such as "January 12, 1952" or "3:30:32pm"
+//     Full is pretty complete; e.g. "Tuesday, April 12, 1952 AD" or "3:30:42pm PST"
+// The specifications though are left fuzzy, in part simply because a user's
+// preference choices may affect the output, and also the results may change
+// from one OS release to another.  To produce an exactly formatted date you
+// should not rely on styles and localization, but set the format string and
+// use nothing but numbers.
+
+// CFDateFormatters are not thread-safe.  Do not use one from multiple threads!
+// The format string is compiled when it is set, not on every call, so a
+// formatter configured once (fixed format, "en_US_POSIX" locale and a fixed
+// time zone for machine timestamps such as ISO 8601 or RFC 1123) and reused
+// per thread avoids paying for the pattern and the locale data again.
+
+@:framework("CoreFoundation")
+extern class CFDateFormatter {
+
+	//Constants
+	public static var kCFDateFormatterIsLenient :CFStringRef;	// CFBoolean
+	public static var kCFDateFormatterTimeZone :CFStringRef;	// CFTimeZone
+	public static var kCFDateFormatterCalendarName :CFStringRef;	// CFString
+	public static var kCFDateFormatterDefaultFormat :CFStringRef;	// CFString
+	public static var kCFDateFormatterTwoDigitStartDate :CFStringRef;	// CFDate
+	public static var kCFDateFormatterDefaultDate :CFStringRef;	// CFDate
+	public static var kCFDateFormatterCalendar :CFStringRef;	// CFCalendar
+	public static var kCFDateFormatterEraSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterAMSymbol :CFStringRef;	// CFString
+	public static var kCFDateFormatterPMSymbol :CFStringRef;	// CFString
+	public static var kCFDateFormatterLongEraSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterVeryShortMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterStandaloneMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortStandaloneMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterVeryShortStandaloneMonthSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterVeryShortWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterStandaloneWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortStandaloneWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterVeryShortStandaloneWeekdaySymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterQuarterSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortQuarterSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterStandaloneQuarterSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterShortStandaloneQuarterSymbols :CFStringRef;	// CFArray of CFString
+	public static var kCFDateFormatterGregorianStartDate :CFStringRef;	// CFDate
+	public static var kCFDateFormatterDoesRelativeDateFormattingKey :CFStringRef;	// CFBoolean
+
+// See CFLocale.h for these calendar constants:
+//	const CFStringRef kCFGregorianCalendar;
+//	const CFStringRef kCFBuddhistCalendar;
+//	const CFStringRef kCFJapaneseCalendar;
+//	const CFStringRef kCFIslamicCalendar;
+//	const CFStringRef kCFIslamicCivilCalendar;
+//	const CFStringRef kCFHebrewCalendar;
+//	const CFStringRef kCFChineseCalendar;
+//	const CFStringRef kCFRepublicOfChinaCalendar;
+//	const CFStringRef kCFPersianCalendar;
+//	const CFStringRef kCFIndianCalendar;
+//	const CFStringRef kCFISO8601Calendar;
+
+	// no options defined, pass 0 for now
+	@:require(osx10_6)
+	@:require(ios4)
+	@:c public static function CFDateFormatterCreateDateFormatFromTemplate(allocator:CFAllocatorRef, tmplate:CFStringRef, options:CFOptionFlags, locale:CFLocaleRef) :CFStringRef;
+
+	@:c public static function CFDateFormatterGetTypeID() :CFTypeID;
+
+	// Returns a CFDateFormatter, localized to the given locale, which
+	// will format dates to the given date and time styles.
+	@:c public static function CFDateFormatterCreate(allocator:CFAllocatorRef, locale:CFLocaleRef, dateStyle:CFDateFormatterStyle, timeStyle:CFDateFormatterStyle) :CFDateFormatterRef;
+
+	// Get the properties with which the date formatter was created.
+	@:c public static function CFDateFormatterGetLocale(formatter:CFDateFormatterRef) :CFLocaleRef;
+	@:c public static function CFDateFormatterGetDateStyle(formatter:CFDateFormatterRef) :CFDateFormatterStyle;
+	@:c public static function CFDateFormatterGetTimeStyle(formatter:CFDateFormatterRef) :CFDateFormatterStyle;
+
+	// Set the format description string of the date formatter.  This
+	// overrides the style settings.  The format of the format string
+	// is as defined by the ICU library.  The date formatter starts with a
+	// default format string defined by the style arguments with
+	// which it was created.
+	@:c public static function CFDateFormatterGetFormat(formatter:CFDateFormatterRef) :CFStringRef;
+	@:c public static function CFDateFormatterSetFormat(formatter:CFDateFormatterRef, formatString:CFStringRef) :Void;
+
+	// Create a string representation of the given date or CFAbsoluteTime
+	// using the current state of the date formatter.
+	// The absolute time variants avoid creating a CFDate per timestamp.
+	@:c public static function CFDateFormatterCreateStringWithDate(allocator:CFAllocatorRef, formatter:CFDateFormatterRef, date:CFDateRef) :CFStringRef;
+	@:c public static function CFDateFormatterCreateStringWithAbsoluteTime(allocator:CFAllocatorRef, formatter:CFDateFormatterRef, at:CFAbsoluteTime) :CFStringRef;
+
+	// Parse a string representation of a date using the current state
+	// of the date formatter.  The range parameter specifies the range
+	// of the string in which the parsing should occur in input, and on
+	// output indicates the extent that was used; this parameter can
+	// be NULL, in which case the whole string may be used.  The
+	// return value indicates whether some date was computed and
+	// (if atp is not NULL) stored at the location specified by atp.
+	@:c public static function CFDateFormatterCreateDateFromString(allocator:CFAllocatorRef, formatter:CFDateFormatterRef, string:CFStringRef, rangep:CFRange) :CFDateRef;
+	@:c public static function CFDateFormatterGetAbsoluteTimeFromString(formatter:CFDateFormatterRef, string:CFStringRef, rangep:CFRange, atp:CFAbsoluteTime) :Bool;
+
+	// Set and get various properties of the date formatter, the set of
+	// which may be expanded in the future.
+	@:c public static function CFDateFormatterSetProperty(formatter:CFDateFormatterRef, key:CFStringRef, value:CFTypeRef) :Void;
+	@:c public static function CFDateFormatterCopyProperty(formatter:CFDateFormatterRef, key:CFStringRef) :CFTypeRef;
+
+}
@@ -0,0 +1,55 @@
+/*	CFFileDescriptor.h
+	Copyright (c) 2006-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFFileDescriptorNativeDescriptor = Int;
+
+typedef CFFileDescriptorRef = CFFileDescriptor;
+
+typedef CFFileDescriptorCallBack = CFFileDescriptorRef -> CFOptionFlags -> Dynamic -> Void;
+
+typedef CFFileDescriptorContext = {
+    var version :CFIndex;
+    var info :Dynamic;
+    var retain :Dynamic -> Dynamic;
+    var release :Dynamic -> Void;
+    var copyDescription :Dynamic -> CFStringRef;
+}
+
+/* Callbacks are one-shot: after one fires it stays disabled until
+   CFFileDescriptorEnableCallBacks is called again. Put the descriptor in
+   non-blocking mode and, in the callback, read (or write) with large
+   buffers until the call would block before re-enabling; one wakeup then
+   moves everything that is ready instead of one buffer per run loop pass. */
+
+@:require(osx10_5)
+@:require(ios2)
+@:framework("CoreFoundation")
+extern class CFFileDescriptor {
+
+	//Constants
+	/* Callback Reason Types */
+	inline public static var kCFFileDescriptorReadCallBack = 1;
+	inline public static var kCFFileDescriptorWriteCallBack = 2;
+
+	@:c public static function CFFileDescriptorGetTypeID() :CFTypeID;
+
+	@:c public static function CFFileDescriptorCreate(allocator:CFAllocatorRef, fd:CFFileDescriptorNativeDescriptor, closeOnInvalidate:Bool, callout:CFFileDescriptorCallBack, context:CFFileDescriptorContext) :CFFileDescriptorRef;
+
+	@:c public static function CFFileDescriptorGetNativeDescriptor(f:CFFileDescriptorRef) :CFFileDescriptorNativeDescriptor;
+
+	@:c public static function CFFileDescriptorGetContext(f:CFFileDescriptorRef, context:CFFileDescriptorContext) :Void;
+
+	@:c public static function CFFileDescriptorEnableCallBacks(f:CFFileDescriptorRef, callBackTypes:CFOptionFlags) :Void;
+	@:c public static function CFFileDescriptorDisableCallBacks(f:CFFileDescriptorRef, callBackTypes:CFOptionFlags) :Void;
+
+	@:c public static function CFFileDescriptorInvalidate(f:CFFileDescriptorRef) :Void;
+	@:c public static function CFFileDescriptorIsValid(f:CFFileDescriptorRef) :Bool;
+
+	@:c public static function CFFileDescriptorCreateRunLoopSource(allocator:CFAllocatorRef, f:CFFileDescriptorRef, order:CFIndex) :CFRunLoopSourceRef;
+
+}
@@ -0,0 +1,64 @@
+/*	CFMessagePort.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+import swift.corefoundation.CFData;
+
+typedef CFMessagePortRef = CFMessagePort;
+
+typedef CFMessagePortContext = {
+    var version :CFIndex;
+    var info :Dynamic;
+    var retain :Dynamic -> Dynamic;
+    var release :Dynamic -> Void;
+    var copyDescription :Dynamic -> CFStringRef;
+}
+
+/* If callout wants to keep a hold of the data past the return of the callout, it must COPY the data. This includes the case where the data is given to some routine which _might_ keep a hold of it; System will release returned CFData. */
+typedef CFMessagePortCallBack = CFMessagePortRef -> SInt32 -> CFDataRef -> Dynamic -> CFDataRef;
+typedef CFMessagePortInvalidationCallBack = CFMessagePortRef -> Dynamic -> Void;
+
+@:framework("CoreFoundation")
+extern class CFMessagePort {
+
+	//Constants
+	inline public static var kCFMessagePortSuccess = 0;
+	inline public static var kCFMessagePortSendTimeout = -1;
+	inline public static var kCFMessagePortReceiveTimeout = -2;
+	inline public static var kCFMessagePortIsInvalid = -3;
+	inline public static var kCFMessagePortTransportError = -4;
+	inline public static var kCFMessagePortBecameInvalidError = -5;
+
+	@:c public static function CFMessagePortGetTypeID() :CFTypeID;
+
+	@:c public static function CFMessagePortCreateLocal(allocator:CFAllocatorRef, name:CFStringRef, callout:CFMessagePortCallBack, context:CFMessagePortContext, shouldFreeInfo:Bool) :CFMessagePortRef;
+	@:c public static function CFMessagePortCreateRemote(allocator:CFAllocatorRef, name:CFStringRef) :CFMessagePortRef;
+
+	@:c public static function CFMessagePortIsRemote(ms:CFMessagePortRef) :Bool;
+	@:c public static function CFMessagePortGetName(ms:CFMessagePortRef) :CFStringRef;
+	@:c public static function CFMessagePortSetName(ms:CFMessagePortRef, newName:CFStringRef) :Bool;
+	@:c public static function CFMessagePortGetContext(ms:CFMessagePortRef, context:CFMessagePortContext) :Void;
+	@:c public static function CFMessagePortInvalidate(ms:CFMessagePortRef) :Void;
+	@:c public static function CFMessagePortIsValid(ms:CFMessagePortRef) :Bool;
+	@:c public static function CFMessagePortGetInvalidationCallBack(ms:CFMessagePortRef) :CFMessagePortInvalidationCallBack;
+	@:c public static function CFMessagePortSetInvalidationCallBack(ms:CFMessagePortRef, callout:CFMessagePortInvalidationCallBack) :Void;
+
+/* NULL replyMode argument means no return value expected, dont wait for it */
+/* Each request is one Mach message and, with a reply mode, one more for the
+   reply. Small messages that need no answer should pass NULL so the sender
+   does not block for a round trip; batching several small payloads into one
+   CFData also saves a message per payload. */
+	@:c public static function CFMessagePortSendRequest(remote:CFMessagePortRef, msgid:SInt32, data:CFDataRef, sendTimeout:CFTimeInterval, rcvTimeout:CFTimeInterval, replyMode:CFStringRef, returnData:CFDataRef) :SInt32;
+
+	@:c public static function CFMessagePortCreateRunLoopSource(allocator:CFAllocatorRef, local:CFMessagePortRef, order:CFIndex) :CFRunLoopSourceRef;
+
+/* Receives on `queue' instead of a run loop, so a busy main thread does not
+   delay replies. Use either this or a run loop source, not both. */
+	@:require(osx10_6)
+	@:require(ios4)
+	@:c public static function CFMessagePortSetDispatchQueue(ms:CFMessagePortRef, queue:Dynamic) :Void;
+
+}
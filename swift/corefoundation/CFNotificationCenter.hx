@@ -0,0 +1,72 @@
+/*	CFNotificationCenter.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFNotificationCenterRef = CFNotificationCenter;
+
+typedef CFNotificationCallback = CFNotificationCenterRef -> Dynamic -> CFStringRef -> Dynamic -> CFDictionaryRef -> Void;
+
+@:framework("CoreFoundation")
+extern enum CFNotificationSuspensionBehavior {
+    CFNotificationSuspensionBehaviorDrop;
+        // The server will not queue any notifications with this name and object while the process/app is in the background.
+    CFNotificationSuspensionBehaviorCoalesce;
+        // The server will only queue the last notification of the specified name and object; earlier notifications are dropped.
+    CFNotificationSuspensionBehaviorHold;
+        // The server will hold all matching notifications until the queue has been filled (queue size determined by the server) at which point the server may flush queued notifications.
+    CFNotificationSuspensionBehaviorDeliverImmediately;
+        // The server will deliver notifications matching this registration whether or not the process is in the background.  When a notification with this suspension behavior is matched, it has the effect of first flushing any queued notifications.
+}
+
+@:framework("CoreFoundation")
+extern class CFNotificationCenter {
+
+	//Constants
+	inline public static var kCFNotificationDeliverImmediately = 1;
+	inline public static var kCFNotificationPostToAllSessions = 2;
+
+	@:c public static function CFNotificationCenterGetTypeID() :CFTypeID;
+
+	@:c public static function CFNotificationCenterGetLocalCenter() :CFNotificationCenterRef;
+
+#if osx
+	@:c public static function CFNotificationCenterGetDistributedCenter() :CFNotificationCenterRef;
+#end
+
+// The Darwin Notify Center is based on the <notify.h> API.
+// For this center, there are limitations in the API. There are no notification "objects",
+// "userInfo" cannot be passed in the notification, and there are no suspension behaviors
+// (always "deliver immediately"). Other limitations in the <notify.h> API as described in
+// that header will also apply.
+// - In the CFNotificationCallback, the 'object' and 'userInfo' parameters must be ignored.
+// - CFNotificationCenterAddObserver(): the 'object' and 'suspensionBehavior' arguments are ignored.
+// - CFNotificationCenterAddObserver(): the 'name' argument may not be NULL (for this center).
+// - CFNotificationCenterRemoveObserver(): the 'object' argument is ignored.
+// - CFNotificationCenterPostNotification(): the 'object', 'userInfo', and 'deliverImmediately' arguments are ignored.
+// - CFNotificationCenterPostNotificationWithOptions(): the 'object', 'userInfo', and 'options' arguments are ignored.
+// The Darwin Notify Center has no notion of per-user sessions, all notifications are system-wide.
+// As with distributed notifications, the main thread's run loop must be running in one of the
+// common modes (usually kCFRunLoopDefaultMode) for Darwin-style notifications to be delivered.
+// NOTE: NULL or 0 should be passed for all ignored arguments to ensure future compatibility.
+
+	@:c public static function CFNotificationCenterGetDarwinNotifyCenter() :CFNotificationCenterRef;
+
+// An observer registered with a NULL name is a candidate for every post on
+// the center, so give a name (and an object, when known) whenever the
+// observer only cares about one notification.
+
+	@:c public static function CFNotificationCenterAddObserver(center:CFNotificationCenterRef, observer:Dynamic, callBack:CFNotificationCallback, name:CFStringRef, object:Dynamic, suspensionBehavior:CFNotificationSuspensionBehavior) :Void;
+
+	@:c public static function CFNotificationCenterRemoveObserver(center:CFNotificationCenterRef, observer:Dynamic, name:CFStringRef, object:Dynamic) :Void;
+
+	@:c public static function CFNotificationCenterRemoveEveryObserver(center:CFNotificationCenterRef, observer:Dynamic) :Void;
+
+	@:c public static function CFNotificationCenterPostNotification(center:CFNotificationCenterRef, name:CFStringRef, object:Dynamic, userInfo:CFDictionaryRef, deliverImmediately:Bool) :Void;
+
+	@:c public static function CFNotificationCenterPostNotificationWithOptions(center:CFNotificationCenterRef, name:CFStringRef, object:Dynamic, userInfo:CFDictionaryRef, options:CFOptionFlags) :Void;
+
+}
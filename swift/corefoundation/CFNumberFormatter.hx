@@ -0,0 +1,139 @@
+/*	CFNumberFormatter.h
+	Copyright (c) 2003-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFNumberFormatterRef = CFNumberFormatter;
+
+@:framework("CoreFoundation")
+extern enum CFNumberFormatterStyle {	// number format styles
+	kCFNumberFormatterNoStyle;
+	kCFNumberFormatterDecimalStyle;
+	kCFNumberFormatterCurrencyStyle;
+	kCFNumberFormatterPercentStyle;
+	kCFNumberFormatterScientificStyle;
+	kCFNumberFormatterSpellOutStyle;
+}
+
+@:framework("CoreFoundation")
+extern enum CFNumberFormatterRoundingMode {
+	kCFNumberFormatterRoundCeiling;
+	kCFNumberFormatterRoundFloor;
+	kCFNumberFormatterRoundDown;
+	kCFNumberFormatterRoundUp;
+	kCFNumberFormatterRoundHalfEven;
+	kCFNumberFormatterRoundHalfDown;
+	kCFNumberFormatterRoundHalfUp;
+}
+
+@:framework("CoreFoundation")
+extern enum CFNumberFormatterPadPosition {
+	kCFNumberFormatterPadBeforePrefix;
+	kCFNumberFormatterPadAfterPrefix;
+	kCFNumberFormatterPadBeforeSuffix;
+	kCFNumberFormatterPadAfterSuffix;
+}
+
+// CFNumberFormatters are not thread-safe.  Do not use one from multiple threads!
+// Creating one loads the locale's ICU data and compiles its pattern, which
+// costs far more than formatting a number, so keep one per thread, locale
+// and style and reuse it rather than creating one per call.
+
+@:framework("CoreFoundation")
+extern class CFNumberFormatter {
+
+	//Constants
+	inline public static var kCFNumberFormatterParseIntegersOnly = 1;	/* only parse integers */
+
+	public static var kCFNumberFormatterCurrencyCode :CFStringRef;	// CFString
+	public static var kCFNumberFormatterDecimalSeparator :CFStringRef;	// CFString
+	public static var kCFNumberFormatterCurrencyDecimalSeparator :CFStringRef;	// CFString
+	public static var kCFNumberFormatterAlwaysShowDecimalSeparator :CFStringRef;	// CFBoolean
+	public static var kCFNumberFormatterGroupingSeparator :CFStringRef;	// CFString
+	public static var kCFNumberFormatterUseGroupingSeparator :CFStringRef;	// CFBoolean
+	public static var kCFNumberFormatterPercentSymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterZeroSymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterNaNSymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterInfinitySymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterMinusSign :CFStringRef;	// CFString
+	public static var kCFNumberFormatterPlusSign :CFStringRef;	// CFString
+	public static var kCFNumberFormatterCurrencySymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterExponentSymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterMinIntegerDigits :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterMaxIntegerDigits :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterMinFractionDigits :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterMaxFractionDigits :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterGroupingSize :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterSecondaryGroupingSize :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterRoundingMode :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterRoundingIncrement :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterFormatWidth :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterPaddingPosition :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterPaddingCharacter :CFStringRef;	// CFString
+	public static var kCFNumberFormatterDefaultFormat :CFStringRef;	// CFString
+	public static var kCFNumberFormatterMultiplier :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterPositivePrefix :CFStringRef;	// CFString
+	public static var kCFNumberFormatterPositiveSuffix :CFStringRef;	// CFString
+	public static var kCFNumberFormatterNegativePrefix :CFStringRef;	// CFString
+	public static var kCFNumberFormatterNegativeSuffix :CFStringRef;	// CFString
+	public static var kCFNumberFormatterPerMillSymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterInternationalCurrencySymbol :CFStringRef;	// CFString
+	public static var kCFNumberFormatterCurrencyGroupingSeparator :CFStringRef;	// CFString
+	public static var kCFNumberFormatterIsLenient :CFStringRef;	// CFBoolean
+	public static var kCFNumberFormatterUseSignificantDigits :CFStringRef;	// CFBoolean
+	public static var kCFNumberFormatterMinSignificantDigits :CFStringRef;	// CFNumber
+	public static var kCFNumberFormatterMaxSignificantDigits :CFStringRef;	// CFNumber
+
+	@:c public static function CFNumberFormatterGetTypeID() :CFTypeID;
+
+	// Returns a CFNumberFormatter, localized to the given locale, which
+	// will format numbers to the given style.
+	@:c public static function CFNumberFormatterCreate(allocator:CFAllocatorRef, locale:CFLocaleRef, style:CFNumberFormatterStyle) :CFNumberFormatterRef;
+
+	// Get the properties with which the number formatter was created.
+	@:c public static function CFNumberFormatterGetLocale(formatter:CFNumberFormatterRef) :CFLocaleRef;
+	@:c public static function CFNumberFormatterGetStyle(formatter:CFNumberFormatterRef) :CFNumberFormatterStyle;
+
+	// Set the format description string of the number formatter.  This
+	// overrides the style settings.  The format of the format string
+	// is as defined by the ICU library, and is similar to that found
+	// in Microsoft Excel and NSNumberFormatter.
+	// The number formatter starts with a default format string defined
+	// by the style argument with which it was created.
+	@:c public static function CFNumberFormatterGetFormat(formatter:CFNumberFormatterRef) :CFStringRef;
+	@:c public static function CFNumberFormatterSetFormat(formatter:CFNumberFormatterRef, formatString:CFStringRef) :Void;
+
+	// Create a string representation of the given number or value
+	// using the current state of the number formatter.
+	// The value variant formats a raw value without boxing it in a CFNumber first.
+	@:c public static function CFNumberFormatterCreateStringWithNumber(allocator:CFAllocatorRef, formatter:CFNumberFormatterRef, number:CFNumberRef) :CFStringRef;
+	@:c public static function CFNumberFormatterCreateStringWithValue(allocator:CFAllocatorRef, formatter:CFNumberFormatterRef, numberType:CFNumberType, valuePtr:Dynamic) :CFStringRef;
+
+	// Parse a string representation of a number using the current state
+	// of the number formatter.  The range parameter specifies the range
+	// of the string in which the parsing should occur in input, and on
+	// output indicates the extent that was used; this parameter can
+	// be NULL, in which case the whole string may be used.  The
+	// return value indicates whether some number was computed and
+	// (if valuePtr is not NULL) stored at the location specified by
+	// valuePtr.  The numberType indicates the type of value pointed
+	// to by valuePtr.
+	@:c public static function CFNumberFormatterCreateNumberFromString(allocator:CFAllocatorRef, formatter:CFNumberFormatterRef, string:CFStringRef, rangep:CFRange, options:CFOptionFlags) :CFNumberRef;
+	@:c public static function CFNumberFormatterGetValueFromString(formatter:CFNumberFormatterRef, string:CFStringRef, rangep:CFRange, numberType:CFNumberType, valuePtr:Dynamic) :Bool;
+
+	// Set and get various properties of the number formatter, the set of
+	// which may be expanded in the future.
+	@:c public static function CFNumberFormatterSetProperty(formatter:CFNumberFormatterRef, key:CFStringRef, value:CFTypeRef) :Void;
+	@:c public static function CFNumberFormatterCopyProperty(formatter:CFNumberFormatterRef, key:CFStringRef) :CFTypeRef;
+
+	// Returns the number of fraction digits that should be displayed, and
+	// the rounding increment (or 0.0 if no rounding is done by the currency)
+	// for the given currency.  Returns false if the currency code is unknown
+	// or the information is not available.
+	// Not localized because these are properties of the currency.
+	@:c public static function CFNumberFormatterGetDecimalInfoForCurrencyCode(currencyCode:CFStringRef, defaultFractionDigits:Int, roundingIncrement:Float) :Bool;
+
+}
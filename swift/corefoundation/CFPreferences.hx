@@ -0,0 +1,109 @@
+/*	CFPreferences.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+/* NOTE: All CFPropertyListRef values returned from
+         CFPreferences API should be assumed to be immutable.
+*/
+
+/*	The "App" functions search the various sources of defaults that
+	apply to the given application, and should never be called with
+	kCFPreferencesAnyApplication - only kCFPreferencesCurrentApplication
+	or an application's ID (its bundle identifier).
+*/
+
+/* Set and copy only touch the in-memory cache of the domain; the backing
+   plist is written as a whole when the domain is synchronized. Calling a
+   Synchronize function after every set therefore rewrites the file once
+   per change. On a hot path, set the values (CFPreferencesSetMultiple for
+   several at once) and leave the write to a single Synchronize from a
+   background queue or at a quiet point such as entering the background. */
+
+@:framework("CoreFoundation")
+extern class CFPreferences {
+
+	//Constants
+	public static var kCFPreferencesAnyApplication :CFStringRef;
+	public static var kCFPreferencesCurrentApplication :CFStringRef;
+	public static var kCFPreferencesAnyHost :CFStringRef;
+	public static var kCFPreferencesCurrentHost :CFStringRef;
+	public static var kCFPreferencesAnyUser :CFStringRef;
+	public static var kCFPreferencesCurrentUser :CFStringRef;
+
+/* Searches the various sources of application defaults to find the
+value for the given key. key must not be NULL.  If a value is found,
+it returns it; otherwise returns NULL.  Caller must release the
+returned value */
+	@:c public static function CFPreferencesCopyAppValue(key:CFStringRef, applicationID:CFStringRef) :CFPropertyListRef;
+
+/* Convenience to interpret a preferences value as a boolean directly.
+Returns false if the key doesn't exist, or has an improper format; under
+those conditions, keyExistsAndHasValidFormat (if non-NULL) is set to false */
+	@:c public static function CFPreferencesGetAppBooleanValue(key:CFStringRef, applicationID:CFStringRef, keyExistsAndHasValidFormat:Bool) :Bool;
+
+/* Convenience to interpret a preferences value as an integer directly.
+Returns 0 if the key doesn't exist, or has an improper format; under
+those conditions, keyExistsAndHasValidFormat (if non-NULL) is set to false */
+	@:c public static function CFPreferencesGetAppIntegerValue(key:CFStringRef, applicationID:CFStringRef, keyExistsAndHasValidFormat:Bool) :CFIndex;
+
+/* Sets the given value for the given key in the "normal" place for
+application preferences.  key must not be NULL.  If value is NULL,
+key is removed instead. */
+	@:c public static function CFPreferencesSetAppValue(key:CFStringRef, value:CFPropertyListRef, applicationID:CFStringRef) :Void;
+
+/* Adds the preferences for the given suite to the app preferences for
+   the specified application.  To write to the suite domain, use
+   CFPreferencesSetValue(), below, using the suiteName in place
+   of the appName */
+	@:c public static function CFPreferencesAddSuitePreferencesToApp(applicationID:CFStringRef, suiteID:CFStringRef) :Void;
+
+	@:c public static function CFPreferencesRemoveSuitePreferencesFromApp(applicationID:CFStringRef, suiteID:CFStringRef) :Void;
+
+/* Writes all changes in all sources of application defaults.
+Returns success or failure. */
+	@:c public static function CFPreferencesAppSynchronize(applicationID:CFStringRef) :Bool;
+
+/* The primitive get mechanism; all arguments must be non-NULL
+(use the constants above for common values).  Only the exact
+location specified by app-user-host is searched.  The returned
+CFType must be released by the caller when it is finished with it. */
+	@:c public static function CFPreferencesCopyValue(key:CFStringRef, applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :CFPropertyListRef;
+
+/* Convenience to fetch multiple keys at once.  Keys in 
+keysToFetch that are not present in the returned dictionary
+are not present in the domain.  If keysToFetch is NULL, all
+keys are fetched. */
+	@:c public static function CFPreferencesCopyMultiple(keysToFetch:CFArrayRef, applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :CFDictionaryRef;
+
+/* The primitive set function; all arguments except value must be
+non-NULL.  If value is NULL, the given key is removed */
+	@:c public static function CFPreferencesSetValue(key:CFStringRef, value:CFPropertyListRef, applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :Void;
+
+/* Convenience to set multiple values at once.  Behavior is undefined
+if a key is in both keysToSet and keysToRemove */
+	@:c public static function CFPreferencesSetMultiple(keysToSet:CFDictionaryRef, keysToRemove:CFArrayRef, applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :Void;
+
+	@:c public static function CFPreferencesSynchronize(applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :Bool;
+
+/* Constructs and returns the list of the name of all applications
+which have preferences in the scope of the given user and host.
+The returned value must be released by the caller; neither argument
+may be NULL. */
+	@:c public static function CFPreferencesCopyApplicationList(userName:CFStringRef, hostName:CFStringRef) :CFArrayRef;
+
+/* Constructs and returns the list of all keys set in the given
+location.  The returned value must be released by the caller;
+all arguments must be non-NULL */
+	@:c public static function CFPreferencesCopyKeyList(applicationID:CFStringRef, userName:CFStringRef, hostName:CFStringRef) :CFArrayRef;
+
+/* Function to determine whether or not a given key has been imposed on the
+user - In cases where machines and/or users are under some kind of management,
+callers should use this function to determine whether or not to disable UI elements
+corresponding to those preference keys. */
+	@:c public static function CFPreferencesAppValueIsForced(key:CFStringRef, applicationID:CFStringRef) :Bool;
+
+}
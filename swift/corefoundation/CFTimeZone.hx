@@ -0,0 +1,85 @@
+/*	CFTimeZone.h
+	Copyright (c) 1998-2012, Apple Inc. All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+import swift.corefoundation.CFData;
+
+typedef CFTimeZoneRef = CFTimeZone;
+
+@:require(osx10_5)
+@:require(ios2)
+@:framework("CoreFoundation")
+extern enum CFTimeZoneNameStyle {
+	kCFTimeZoneNameStyleStandard;
+	kCFTimeZoneNameStyleShortStandard;
+	kCFTimeZoneNameStyleDaylightSaving;
+	kCFTimeZoneNameStyleShortDaylightSaving;
+	kCFTimeZoneNameStyleGeneric;
+	kCFTimeZoneNameStyleShortGeneric;
+}
+
+@:framework("CoreFoundation")
+extern class CFTimeZone {
+
+	//Constants
+	@:require(osx10_5)
+	@:require(ios2)
+	public static var kCFTimeZoneSystemTimeZoneDidChangeNotification :CFStringRef;
+
+	@:c public static function CFTimeZoneGetTypeID() :CFTypeID;
+
+	@:c public static function CFTimeZoneCopySystem() :CFTimeZoneRef;
+
+	@:c public static function CFTimeZoneResetSystem() :Void;
+
+	@:c public static function CFTimeZoneCopyDefault() :CFTimeZoneRef;
+
+	@:c public static function CFTimeZoneSetDefault(tz:CFTimeZoneRef) :Void;
+
+	@:c public static function CFTimeZoneCopyKnownNames() :CFArrayRef;
+
+	@:c public static function CFTimeZoneCopyAbbreviationDictionary() :CFDictionaryRef;
+
+	@:c public static function CFTimeZoneSetAbbreviationDictionary(dict:CFDictionaryRef) :Void;
+
+/* `data' must hold the contents of a TZif file and is parsed as such. To
+   load a zone from the system by its name, use CFTimeZoneCreateWithName. */
+
+	@:c public static function CFTimeZoneCreate(allocator:CFAllocatorRef, name:CFStringRef, data:CFDataRef) :CFTimeZoneRef;
+
+	@:c public static function CFTimeZoneCreateWithTimeIntervalFromGMT(allocator:CFAllocatorRef, ti:CFTimeInterval) :CFTimeZoneRef;
+
+	@:c public static function CFTimeZoneCreateWithName(allocator:CFAllocatorRef, name:CFStringRef, tryAbbrev:Bool) :CFTimeZoneRef;
+
+	@:c public static function CFTimeZoneGetName(tz:CFTimeZoneRef) :CFStringRef;
+
+	@:c public static function CFTimeZoneGetData(tz:CFTimeZoneRef) :CFDataRef;
+
+/* Each call searches the zone's transition table. When converting many
+   timestamps in ascending order, ask for the offset once together with
+   CFTimeZoneGetNextDaylightSavingTimeTransition: the offset stays the same
+   for every timestamp before that transition, so a lookup is only needed
+   again once it has been passed. */
+
+	@:c public static function CFTimeZoneGetSecondsFromGMT(tz:CFTimeZoneRef, at:CFAbsoluteTime) :CFTimeInterval;
+
+	@:c public static function CFTimeZoneCopyAbbreviation(tz:CFTimeZoneRef, at:CFAbsoluteTime) :CFStringRef;
+
+	@:c public static function CFTimeZoneIsDaylightSavingTime(tz:CFTimeZoneRef, at:CFAbsoluteTime) :Bool;
+
+	@:require(osx10_5)
+	@:require(ios2)
+	@:c public static function CFTimeZoneGetDaylightSavingTimeOffset(tz:CFTimeZoneRef, at:CFAbsoluteTime) :CFTimeInterval;
+
+	@:require(osx10_5)
+	@:require(ios2)
+	@:c public static function CFTimeZoneGetNextDaylightSavingTimeTransition(tz:CFTimeZoneRef, at:CFAbsoluteTime) :CFAbsoluteTime;
+
+	@:require(osx10_5)
+	@:require(ios2)
+	@:c public static function CFTimeZoneCopyLocalizedName(tz:CFTimeZoneRef, style:CFTimeZoneNameStyle, locale:CFLocaleRef) :CFStringRef;
+
+}
@@ -0,0 +1,85 @@
+/*
+    CFURLEnumerator.h
+    Copyright (c) 2008-2012, Apple Inc. All rights reserved.
+ */
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFURLEnumeratorRef = CFURLEnumerator;
+
+/* CFURLEnumeratorResult - Results for CFURLEnumeratorGetNextURL */
+@:require(osx10_6)
+@:require(ios4)
+@:framework("CoreFoundation")
+extern enum CFURLEnumeratorResult {
+    kCFURLEnumeratorSuccess;                    /* The enumeration was successful. The url output parameter is valid. */
+    kCFURLEnumeratorEnd;                        /* The enumeration is complete. */
+    kCFURLEnumeratorError;                      /* An error occured during enumeration. The retained error output parameter describes the error. */
+    kCFURLEnumeratorDirectoryPostOrderSuccess;  /* The enumeration was successful. The url output parameter is for a directory after all of directory's descendants have been visited (post-order). This result will only be returned for directories when both the kCFURLEnumeratorDescendRecursively and kCFURLEnumeratorIncludeDirectoriesPostOrder options are passed to CFURLEnumeratorCreateForDirectoryURL. */
+}
+
+@:require(osx10_6)
+@:require(ios4)
+@:framework("CoreFoundation")
+extern class CFURLEnumerator {
+
+	//Constants
+	/* CFURLEnumeratorOptions - Options for controlling enumerator behavior. */
+	inline public static var kCFURLEnumeratorDefaultBehavior = 0;               /* Use the default behavior for the enumerator. */
+	inline public static var kCFURLEnumeratorDescendRecursively = 1;            /* The directory enumerator will recurse ("depth-first") into each subdirectory enumerated */
+	inline public static var kCFURLEnumeratorSkipInvisibles = 2;                /* The directory or volume enumerator skips "hidden" or "invisible" objects */
+	inline public static var kCFURLEnumeratorGenerateFileReferenceURLs = 4;     /* The volume enumerator generates file reference URLs */
+	inline public static var kCFURLEnumeratorSkipPackageContents = 8;           /* The directory enumerator skips package directory contents */
+	inline public static var kCFURLEnumeratorIncludeDirectoriesPreOrder = 16;   /* With this option set, a recursive directory enumerator will return directory URLs when CFURLEnumeratorGetNextURL() returns kCFURLEnumeratorSuccess before any of the directory's descendants are visited (pre-order). */
+	inline public static var kCFURLEnumeratorIncludeDirectoriesPostOrder = 32;  /* With this option set, a recursive directory enumerator will return directory URLs when CFURLEnumeratorGetNextURL() returns kCFURLEnumeratorDirectoryPostOrderSuccess after all of directory's descendants have been visited (post-order). */
+	/* Note: if both kCFURLEnumeratorIncludeDirectoriesPreOrder and kCFURLEnumeratorIncludeDirectoriesPostOrder are used, directories will be seen twice (even empty directories and directories whose descendants are skipped) -- once when kCFURLEnumeratorSuccess is returned and once when kCFURLEnumeratorDirectoryPostOrderSuccess is returned. */
+
+/* CFURLEnumeratorGetTypeID - Returns the CFURLEnumerator CFTypeID. */
+	@:c public static function CFURLEnumeratorGetTypeID() :CFTypeID;
+
+/* CFURLEnumeratorCreateForDirectoryURL - Creates a directory enumerator, flat or recursive. Client specifies the directory URL to enumerate, a bit array of options, and an optional array of property keys to pre-fetch for the found URLs. Specifying pre-fetch properties allows the implementation to optimize device access by using bulk operations when available. Pre-fetching more properties than are actually needed may degrade performance.
+
+A directory enumerator generates URLs with the same type as the directory URL being enumerated. If the directoryURL input parameter is a file reference URL, then generated URLs will be file reference URLs. If the directoryURL input parameter is a file path URL, then generated URLs will be file path URLs.
+
+The kCFURLEnumeratorGenerateFileReferenceURLs option is ignored by CFURLEnumeratorCreateForDirectoryURL.
+
+An enumerator walks its tree on the calling thread. Enumerators are independent of each other, so a large tree can be split by listing the top level flat and giving each subdirectory its own recursive enumerator on a separate queue.
+*/
+	@:c public static function CFURLEnumeratorCreateForDirectoryURL(alloc:CFAllocatorRef, directoryURL:CFURLRef, option:CFOptionFlags, propertyKeys:CFArrayRef) :CFURLEnumeratorRef;
+
+/* CFURLEnumeratorCreateForMountedVolumes - Creates an enumerator for mounted filesystem volumes. Client specifies an allocator, a bit array of options, and an optional array of property keys to pre-fetch for the volume URLs. Specifying pre-fetch properties allows the implementation to optimize device access by using bulk operations when available. Pre-fetching more properties than are actually needed may degrade performance.
+
+A volume enumerator generates file path URLs. If you want a volume enumerator to generate file reference URLs, pass the kCFURLEnumeratorGenerateFileReferenceURLs option.
+
+The kCFURLEnumeratorDescendRecursively and kCFURLEnumeratorSkipPackageContents options are ignored by CFURLEnumeratorCreateForMountedVolumes.
+*/
+	@:c public static function CFURLEnumeratorCreateForMountedVolumes(alloc:CFAllocatorRef, option:CFOptionFlags, propertyKeys:CFArrayRef) :CFURLEnumeratorRef;
+
+/* CFURLEnumeratorGetNextURL - Advances the enumerator. If kCFURLEnumeratorSuccess is returned, the url output parameter returns the next URL found. If kCFURLEnumeratorError is returned, an error has occured and the error output parameter describes the error. If kCFURLEnumeratorEnd, the enumeration is finished.
+
+The url output parameter, if returned, is not retained. The error output parameter, if returned, is retained and must be released.
+*/
+	@:c public static function CFURLEnumeratorGetNextURL(enumerator:CFURLEnumeratorRef, url:CFURLRef, error:CFErrorRef) :CFURLEnumeratorResult;
+
+/* CFURLEnumeratorSkipDescendents - Tells a recursive CFURLEnumerator not to descend into the directory of the last CFURLRef returned by CFURLEnumeratorGetNextURL.
+
+Calls to CFURLEnumeratorSkipDescendents are ignored if:
+    * CFURLEnumeratorGetNextURL has never been called with the CFURLEnumerator.
+    * The last CFURL returned by CFURLEnumeratorGetNextURL is not a directory.
+    * The CFURLEnumerator was not created with CFURLEnumeratorCreateForDirectoryURL using the kCFURLEnumeratorDescendRecursively option.
+*/
+	@:c public static function CFURLEnumeratorSkipDescendents(enumerator:CFURLEnumeratorRef) :Void;
+
+/* CFURLEnumeratorGetDescendentLevel - Returns the number of levels a directory enumerator has descended down into the directory hierarchy from the starting directory. The children of the starting directory are at level 1. Each time a recursive enumerator descends into a subdirectory, it adds one to the descendent level. It then subtracts one from the level when it finishes a subdirectory and continues enumerating the parent directory.
+*/
+	@:c public static function CFURLEnumeratorGetDescendentLevel(enumerator:CFURLEnumeratorRef) :CFIndex;
+
+/* CFURLEnumeratorGetSourceDidChange is deprecated. If your program is interested in directory hierarchy changes during enumeration (and most programs are not interested), you should use the File System Events API.
+
+ CFURLEnumeratorGetSourceDidChange does nothing and always returns false.
+ */
+	@:c public static function CFURLEnumeratorGetSourceDidChange(enumerator:CFURLEnumeratorRef) :Bool;
+
+}
@@ -0,0 +1,68 @@
+/*	CFUUID.h
+	Copyright (c) 1999-2012, Apple Inc.  All rights reserved.
+*/
+
+package swift.corefoundation;
+
+import swift.corefoundation.CFBase;
+
+typedef CFUUIDRef = CFUUID;
+
+/* The CFUUIDBytes struct is a 128-bit struct that contains the
+raw UUID.  A CFUUIDRef can provide such a struct from the
+CFUUIDGetUUIDBytes() function.  This struct is suitable for
+passing to APIs that expect a raw UUID.
+*/
+typedef CFUUIDBytes = {
+    var byte0 :UInt8;
+    var byte1 :UInt8;
+    var byte2 :UInt8;
+    var byte3 :UInt8;
+    var byte4 :UInt8;
+    var byte5 :UInt8;
+    var byte6 :UInt8;
+    var byte7 :UInt8;
+    var byte8 :UInt8;
+    var byte9 :UInt8;
+    var byte10 :UInt8;
+    var byte11 :UInt8;
+    var byte12 :UInt8;
+    var byte13 :UInt8;
+    var byte14 :UInt8;
+    var byte15 :UInt8;
+}
+
+@:framework("CoreFoundation")
+extern class CFUUID {
+
+	@:c public static function CFUUIDGetTypeID() :CFTypeID;
+
+/* Create and return a brand new unique identifier */
+
+	@:c public static function CFUUIDCreate(alloc:CFAllocatorRef) :CFUUIDRef;
+
+/* Create and return an identifier with the given contents.  This may return an existing instance with its ref count bumped because of uniquing. */
+
+	@:c public static function CFUUIDCreateWithBytes(alloc:CFAllocatorRef, byte0:UInt8, byte1:UInt8, byte2:UInt8, byte3:UInt8, byte4:UInt8, byte5:UInt8, byte6:UInt8, byte7:UInt8, byte8:UInt8, byte9:UInt8, byte10:UInt8, byte11:UInt8, byte12:UInt8, byte13:UInt8, byte14:UInt8, byte15:UInt8) :CFUUIDRef;
+
+/* Converts from a string representation to the UUID.  This may return an existing instance with its ref count bumped because of uniquing. */
+
+	@:c public static function CFUUIDCreateFromString(alloc:CFAllocatorRef, uuidStr:CFStringRef) :CFUUIDRef;
+
+/* Converts from a UUID to its string representation. */
+
+	@:c public static function CFUUIDCreateString(alloc:CFAllocatorRef, uuid:CFUUIDRef) :CFStringRef;
+
+/* This returns an immortal CFUUIDRef that should not be released.  It can be used in headers to declare UUID constants with #define.
+   Equal bytes always give back the same instance, so the result can be compared by pointer. */
+
+	@:c public static function CFUUIDGetConstantUUIDWithBytes(alloc:CFAllocatorRef, byte0:UInt8, byte1:UInt8, byte2:UInt8, byte3:UInt8, byte4:UInt8, byte5:UInt8, byte6:UInt8, byte7:UInt8, byte8:UInt8, byte9:UInt8, byte10:UInt8, byte11:UInt8, byte12:UInt8, byte13:UInt8, byte14:UInt8, byte15:UInt8) :CFUUIDRef;
+
+/* The bytes form round-trips without going through the 36 character string,
+   which is the cheaper way to store and reload identifiers in bulk. */
+
+	@:c public static function CFUUIDGetUUIDBytes(uuid:CFUUIDRef) :CFUUIDBytes;
+
+	@:c public static function CFUUIDCreateFromUUIDBytes(alloc:CFAllocatorRef, bytes:CFUUIDBytes) :CFUUIDRef;
+
+}
@@ -1,5 +1,6 @@
 package swift.corefoundation;
 
+typedef CFAllocator = swift.corefoundation.CFBase.CFAllocator;
 typedef CFArray = swift.corefoundation.CFArray;
 typedef CFBag = swift.corefoundation.CFBag;
 typedef CFBinaryHeap = swift.corefoundation.CFBinaryHeap;
@@ -9,42 +10,42 @@ typedef CFCalendar = swift.corefoundation.CFCalendar;
 typedef CFCharacterSet = swift.corefoundation.CFCharacterSet;
 typedef CFData = swift.corefoundation.CFData;
 typedef CFDate = swift.corefoundation.CFDate;
-typedef  = swift.corefoundation.CFDateFormatter;
+typedef CFDateFormatter = swift.corefoundation.CFDateFormatter;
 typedef  = swift.corefoundation.CFDictionary;
 typedef  = swift.corefoundation.CFError;
 typedef  = swift.corefoundation.CFLocale;
 typedef  = swift.corefoundation.CFNumber;
-typedef  = swift.corefoundation.CFNumberFormatter;
-typedef  = swift.corefoundation.CFPreferences;
+typedef CFNumberFormatter = swift.corefoundation.CFNumberFormatter;
+typedef CFPreferences = swift.corefoundation.CFPreferences;
 typedef  = swift.corefoundation.CFPropertyList;
 typedef  = swift.corefoundation.CFSet;
 typedef  = swift.corefoundation.CFString;
 typedef  = swift.corefoundation.CFStringEncodingExt;
-typedef  = swift.corefoundation.CFTimeZone;
+typedef CFTimeZone = swift.corefoundation.CFTimeZone;
 typedef  = swift.corefoundation.CFTree;
 typedef  = swift.corefoundation.CFURL;
 typedef  = swift.corefoundation.CFURLAccess;
-typedef  = swift.corefoundation.CFUUID;
+typedef CFUUID = swift.corefoundation.CFUUID;
 typedef  = swift.corefoundation.CFUtilities;
 
 #if osx
 typedef  = swift.corefoundation.CFBundle;
-typedef  = swift.corefoundation.CFMessagePort;
+typedef CFMessagePort = swift.corefoundation.CFMessagePort;
 typedef  = swift.corefoundation.CFPlugIn;
 typedef  = swift.corefoundation.CFRunLoop;
 typedef  = swift.corefoundation.CFStream;
 typedef  = swift.corefoundation.CFSocket;
 #end
 	
-typedef  = swift.corefoundation.CFAttributedString;
-typedef  = swift.corefoundation.CFNotificationCenter;
-typedef  = swift.corefoundation.CFURLEnumerator;
+typedef CFAttributedString = swift.corefoundation.CFAttributedString;
+typedef CFNotificationCenter = swift.corefoundation.CFNotificationCenter;
+typedef CFURLEnumerator = swift.corefoundation.CFURLEnumerator;
 
 #if osx
 typedef  = swift.corefoundation.CFFileSecurity;
 typedef  = swift.corefoundation.CFMachPort;
 typedef  = swift.corefoundation.CFStringTokenizer;
-typedef  = swift.corefoundation.CFFileDescriptor;
+typedef CFFileDescriptor = swift.corefoundation.CFFileDescriptor;
 #end
 
 #if osx
@@ -48,6 +48,8 @@ extern class NSArray extends NSObject implements NSCopying implements NSMutableC
 	public function sortedArrayUsingFunction (comparator:Dynamic->Dynamic->Void->Int, context:Void->Void) :NSArray;
 	//public function sortedArrayUsingFunction (Int (*)(id, id, void *))comparator context (void *)context hint (NSData *) :NSArray;
 	public function sortedArrayUsingSelector (comparator:SEL) :NSArray;
+	public function sortedArrayUsingDescriptors (sortDescriptors:Array<NSSortDescriptor>) :NSArray;
+	public function filteredArrayUsingPredicate (predicate:NSPredicate) :NSArray;
 	public function subarrayWithRange (range:NSRange) :NSArray;
 	public function writeToFile (path:String, atomically:Bool) :Bool;
 	public function writeToURL (url:NSURL, atomically:Bool) :Bool;
@@ -131,6 +133,8 @@ extern class NSMutableArray extends NSArray {
 	public function setArray (otherArray:NSArray) :Void;
 	public function sortUsingFunction (func:Dynamic->Dynamic->Int, context:Void->Void) :Void;
 	public function sortUsingSelector (comparator:SEL) :Void;
+	public function sortUsingDescriptors (sortDescriptors:Array<NSSortDescriptor>) :Void;
+	public function filterUsingPredicate (predicate:NSPredicate) :Void;
 
 	public function insertObjects (objects:NSArray, atIndexes:NSIndexSet) :Void;
 	public function removeObjectsAtIndexes (indexes:NSIndexSet) :Void;
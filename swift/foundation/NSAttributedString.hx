@@ -4,6 +4,8 @@ package swift.foundation;
 @:framework("Foundation")
 extern class NSAttributedString implements NSCopying implements NSMutableCopying implements NSCoding {
 
+	// Wrap a series of mutations in beginEditing/endEditing so attribute
+	// runs are fixed up once for the batch rather than after every call.
 	public function endEditing():Void;
 	public function isEqualToAttributedString( other:NSAttributedString):Bool;
 	public function addAttribute( name:String,  value:Dynamic,  range:NSRange):Void;
@@ -13,6 +15,9 @@ extern class NSAttributedString implements NSCopying implements NSMutableCopying
 	public function beginEditing():Void;
 	public function length():Int;
 	public function initWithAttributedString( attrStr:NSAttributedString):Dynamic;
+	// Visits one run at a time; pass
+	// NSAttributedStringEnumerationLongestEffectiveRangeNotRequired when
+	// adjacent runs need not be merged before the block sees them.
 	public function enumerateAttributesInRange( enumerationRange:NSRange,  opts:NSAttributedStringEnumerationOptions,  block:Dynamic):Void;
 	public function attributesAtIndex( location:Int,  range:NSRangePointer):NSDictionary;
 	//@:overload !!NEED CUSTOM META DATA !!
@@ -1,53 +1,51 @@
 package swift.foundation;
 
+import swift.foundation.NSObject;
+
+/* NSCache is safe to use from several threads without extra locking, but
+   all of them go through the one cache. Caches that are hit hard from many
+   threads can be split into several NSCache instances selected by the key's
+   hash, each with its share of the limits. Eviction is driven by the cost
+   passed to setObject1 (for images, the decoded byte size) against
+   totalCostLimit; objects added with setObject count as cost 0. */
 
 @:framework("Foundation")
-extern class NSCache {
+@:require(osx10_6)
+@:require(ios4)
+extern class NSCache extends NSObject {
 
 	public function name():String;
-	public function objectForKey( key:Dynamic):Dynamic;
-	public function removeAllObjects():Void;
-	public function setEvictsObjectsWithDiscardedContent( b:Bool):Void;
 	public function setName( n:String):Void;
+
+	// The delegate is not retained.
+	public function delegate():NSCacheDelegate;
+	public function setDelegate( d:NSCacheDelegate):Void;
+
+	public function objectForKey( key:Dynamic):Dynamic;
+	// 0 cost
 	public function setObject( obj:Dynamic,  key:Dynamic):Void;
 	//@:overload !!NEED CUSTOM META DATA !!
 	public function setObject1( obj:Dynamic,  key:Dynamic,  g:Int):Void;
+	public function removeObjectForKey( key:Dynamic):Void;
+	public function removeAllObjects():Void;
+
+	// limits are imprecise/not strict
 	public function setTotalCostLimit( lim:Int):Void;
 	public function totalCostLimit():Int;
+
+	// limits are imprecise/not strict
 	public function setCountLimit( lim:Int):Void;
-	public function setDelegate( d:id<NSCacheDelegate>):Void;
-	public function delegate():id<NSCacheDelegate>;
 	public function countLimit():Int;
-	public function evictsObjectsWithDiscardedContent():Bool;
-	public function removeObjectForKey( key:Dynamic):Void;
-	public function cache( cache:NSCache,  obj:Dynamic):Void;
-}
-
-public function setName:(NSString *)n;
-- (NSString *)name;
-
-public function setDelegate:(id <NSCacheDelegate>)d;
-- (id <NSCacheDelegate>)delegate;
-
-- (id)objectForKey:(id)key;
-public function setObject:(id)obj forKey:(id)key; // 0 cost
-public function setObject:(id)obj forKey:(id)key cost:(NSUInteger)g;
-public function removeObjectForKey:(id)key;
-
-public function removeAllObjects;
-
-public function setTotalCostLimit:(NSUInteger)lim;
-- (NSUInteger)totalCostLimit;	// limits are imprecise/not strict
-
-public function setCountLimit:(NSUInteger)lim;
-- (NSUInteger)countLimit;	// limits are imprecise/not strict
-
-- (Bool)evictsObjectsWithDiscardedContent;
-public function setEvictsObjectsWithDiscardedContent:(Bool)b;
 
+	public function evictsObjectsWithDiscardedContent():Bool;
+	public function setEvictsObjectsWithDiscardedContent( b:Bool):Void;
 }
 
-@protocol NSCacheDelegate <NSObject>
-@optional
-public function cache:(NSCache *)cache willEvictObject:(id)obj;
+@:framework("Foundation")
+extern interface NSCacheDelegate {
+#if display
+	// cache:willEvictObject: may be called while the cache is being
+	// modified; keep it short and do not call back into the same cache.
+	public function cache( cache:NSCache,  obj:Dynamic):Void;
+#end
 }
@@ -23,8 +23,15 @@ extern enum NSCalendarUnit {
 	NSHourCalendarUnit;
 	NSMinuteCalendarUnit;
 	NSSecondCalendarUnit;
+	NSWeekCalendarUnit;
 	NSWeekdayCalendarUnit;
 	NSWeekdayOrdinalCalendarUnit;
+	@:require(osx10_6) @:require(ios4) NSQuarterCalendarUnit;
+	@:require(osx10_7) @:require(ios5) NSWeekOfMonthCalendarUnit;
+	@:require(osx10_7) @:require(ios5) NSWeekOfYearCalendarUnit;
+	@:require(osx10_7) @:require(ios5) NSYearForWeekOfYearCalendarUnit;
+	@:require(osx10_7) @:require(ios4) NSCalendarCalendarUnit;
+	@:require(osx10_7) @:require(ios4) NSTimeZoneCalendarUnit;
 }
 
 @:framework("Foundation")
@@ -41,7 +48,7 @@ extern class NSCalendar extends NSObject/* implements NSCopying implements NSCod
 	public function setLocale (locale:NSLocale) :Void;
 	public function locale () :NSLocale;
 
-	public function setTimeZone (tz:Int) :Void;
+	public function setTimeZone (tz:NSTimeZone) :Void;
 	public function timeZone () :NSTimeZone;
 
 	public function setFirstWeekday (weekday:Int) :Void;
@@ -55,11 +62,18 @@ extern class NSCalendar extends NSObject/* implements NSCopying implements NSCod
 	public function maximumRangeOfUnit(unit:NSCalendarUnit) :NSRange;
 
 	public function rangeOfUnit (smaller:NSCalendarUnit, inUnit:NSCalendarUnit, forDate:NSDate) :NSRange;
-	public function ordinalityOfUnit (smaller:NSCalendarUnit, inUnit:NSCalendarUnit, forDate:NSDate) :NSRange;
+	public function ordinalityOfUnit (smaller:NSCalendarUnit, inUnit:NSCalendarUnit, forDate:NSDate) :Int;
 
-	//public function rangeOfUnit (unit:NSCalendarUnit, startDate:NSDate, interval:NSTimeInterval, forDate:NSDate) :Bool;
+	// Start and length of the unit (day, week, month...) containing the date.
+	// Dates inside that interval share the unit, so grouping many dates only
+	// needs a new call once a date falls outside the last interval returned.
+	//@:overload !!NEED CUSTOM META DATA !!
+	@:require(osx10_5)
+	@:require(ios2)
+	public function rangeOfUnit1 (unit:NSCalendarUnit, startDate:NSDate, interval:Float, forDate:NSDate) :Bool;
 
 	public function dateFromComponents (comps:NSDateComponents) :NSDate;
+	// Pass only the units that will be read; every extra flag is computed.
 	public function components (unitFlags:Int, fromDate:NSDate) :NSDateComponents;
 
 	public function dateByAddingComponents (comps:NSDateComponents, toDate:NSDate, options:Int) :NSDate;
@@ -2,58 +2,68 @@
 	Copyright (c) 2004-2012, Apple Inc. All rights reserved.
 */
 
-#import <Foundation/NSPredicate.h>
+package swift.foundation;
 
 // Flags(s) that can be passed to the factory to indicate that a operator operating on strings should do so in a case insensitive fashion.
-typedef NS_OPTIONS(NSUInteger, NSComparisonPredicateOptions) {
-    NSCaseInsensitivePredicateOption = 0x01,
-    NSDiacriticInsensitivePredicateOption = 0x02,
-    NSNormalizedPredicateOption NS_ENUM_AVAILABLE(10_6, 4_0) = 0x04, /* Indicate that the strings to be compared have been preprocessed; this supersedes other options and is intended as a performance optimization option */
-};
+typedef NSComparisonPredicateOptions = Int;
 
 // Describes how the operator is modified: can be direct, ALL, or ANY
-typedef NS_ENUM(NSUInteger, NSComparisonPredicateModifier) {
-    NSDirectPredicateModifier = 0, // Do a direct comparison
-    NSAllPredicateModifier, // ALL toMany.x = y
-    NSAnyPredicateModifier // ANY toMany.x = y
-};
-
+@:framework("Foundation")
+extern enum NSComparisonPredicateModifier {
+	NSDirectPredicateModifier; // Do a direct comparison
+	NSAllPredicateModifier; // ALL toMany.x = y
+	NSAnyPredicateModifier; // ANY toMany.x = y
+}
 
 // Type basic set of operators defined. Most are obvious; NSCustomSelectorPredicateOperatorType allows a developer to create an operator which uses the custom selector specified in the constructor to do the evaluation.
-typedef NS_ENUM(NSUInteger, NSPredicateOperatorType) {
-    NSLessThanPredicateOperatorType = 0, // compare: returns NSOrderedAscending
-    NSLessThanOrEqualToPredicateOperatorType, // compare: returns NSOrderedAscending || NSOrderedSame
-    NSGreaterThanPredicateOperatorType, // compare: returns NSOrderedDescending
-    NSGreaterThanOrEqualToPredicateOperatorType, // compare: returns NSOrderedDescending || NSOrderedSame
-    NSEqualToPredicateOperatorType, // isEqual: returns true
-    NSNotEqualToPredicateOperatorType, // isEqual: returns false
-    NSMatchesPredicateOperatorType,
-    NSLikePredicateOperatorType,
-    NSBeginsWithPredicateOperatorType,
-    NSEndsWithPredicateOperatorType,
-    NSInPredicateOperatorType, // rhs contains lhs returns true
-    NSCustomSelectorPredicateOperatorType,
-    NSContainsPredicateOperatorType NS_ENUM_AVAILABLE(10_5, 3_0) = 99, // lhs contains rhs returns true
-    NSBetweenPredicateOperatorType NS_ENUM_AVAILABLE(10_5, 3_0)
-};
-
+@:framework("Foundation")
+extern enum NSPredicateOperatorType {
+	NSLessThanPredicateOperatorType; // compare: returns NSOrderedAscending
+	NSLessThanOrEqualToPredicateOperatorType; // compare: returns NSOrderedAscending || NSOrderedSame
+	NSGreaterThanPredicateOperatorType; // compare: returns NSOrderedDescending
+	NSGreaterThanOrEqualToPredicateOperatorType; // compare: returns NSOrderedDescending || NSOrderedSame
+	NSEqualToPredicateOperatorType; // isEqual: returns true
+	NSNotEqualToPredicateOperatorType; // isEqual: returns false
+	NSMatchesPredicateOperatorType;
+	NSLikePredicateOperatorType;
+	NSBeginsWithPredicateOperatorType;
+	NSEndsWithPredicateOperatorType;
+	NSInPredicateOperatorType; // rhs contains lhs returns true
+	NSCustomSelectorPredicateOperatorType;
+	NSContainsPredicateOperatorType; // lhs contains rhs returns true
+	NSBetweenPredicateOperatorType;
+}
 
 // Comparison predicates are predicates which do some form of comparison between the results of two expressions and return a Bool. They take an operator, a left expression, and a right expression, and return the result of invoking the operator with the results of evaluating the expressions.
 
+@:framework("Foundation")
+@:require(osx10_4)
+@:require(ios3)
 extern class NSComparisonPredicate extends NSPredicate {
 
-+ (NSPredicate *)predicateWithLeftExpression:(NSExpression *)lhs rightExpression:(NSExpression *)rhs modifier:(NSComparisonPredicateModifier)modifier type:(NSPredicateOperatorType)type options:(NSComparisonPredicateOptions)options;
-+ (NSPredicate *)predicateWithLeftExpression:(NSExpression *)lhs rightExpression:(NSExpression *)rhs customSelector:(SEL)selector;
+	//Constants
+	inline public static var NSCaseInsensitivePredicateOption = 0x01;
+	inline public static var NSDiacriticInsensitivePredicateOption = 0x02;
+	/* Indicate that the strings to be compared have been preprocessed; this supersedes other options and is intended as a performance optimization option.
+	   Fold the stored strings once (for example with lowercaseString and
+	   stringByFoldingWithOptions) and compare against an equally folded
+	   constant, rather than paying for [cd] on every evaluation. */
+	@:require(osx10_6) @:require(ios4) inline public static var NSNormalizedPredicateOption = 0x04;
 
-- (id)initWithLeftExpression:(NSExpression *)lhs rightExpression:(NSExpression *)rhs modifier:(NSComparisonPredicateModifier)modifier type:(NSPredicateOperatorType)type options:(NSComparisonPredicateOptions)options;
-- (id)initWithLeftExpression:(NSExpression *)lhs rightExpression:(NSExpression *)rhs customSelector:(SEL)selector;
+	//Static Methods
+	public static function predicateWithLeftExpression( lhs:NSExpression,  rhs:NSExpression,  modifier:NSComparisonPredicateModifier,  type:NSPredicateOperatorType,  options:NSComparisonPredicateOptions):NSPredicate;
+	//@:overload !!NEED CUSTOM META DATA !!
+	public static function predicateWithLeftExpression1( lhs:NSExpression,  rhs:NSExpression,  selector:SEL):NSPredicate;
 
-- (NSPredicateOperatorType)predicateOperatorType;
-- (NSComparisonPredicateModifier)comparisonPredicateModifier;
-- (NSExpression *)leftExpression;
-- (NSExpression *)rightExpression;
-- (SEL)customSelector;
-- (NSComparisonPredicateOptions)options;
+	//Methods
+	public function initWithLeftExpression( lhs:NSExpression,  rhs:NSExpression,  modifier:NSComparisonPredicateModifier,  type:NSPredicateOperatorType,  options:NSComparisonPredicateOptions):Dynamic;
+	//@:overload !!NEED CUSTOM META DATA !!
+	public function initWithLeftExpression1( lhs:NSExpression,  rhs:NSExpression,  selector:SEL):Dynamic;
 
+	public function predicateOperatorType():NSPredicateOperatorType;
+	public function comparisonPredicateModifier():NSComparisonPredicateModifier;
+	public function leftExpression():NSExpression;
+	public function rightExpression():NSExpression;
+	public function customSelector():SEL;
+	public function options():NSComparisonPredicateOptions;
 }
-
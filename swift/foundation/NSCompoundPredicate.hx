@@ -1,17 +1,21 @@
 package swift.foundation;
 //typedef NSCompoundPredicateType = Int;
 
+@:framework("Foundation")
 extern class NSCompoundPredicate extends NSPredicate {
 
 	public static function notPredicateWithSubpredicate( predicate:NSPredicate) :NSPredicate;
-	public static function andPredicateWithSubpredicates( subpredicates:Array<>) :NSPredicate;
-	public static function orPredicateWithSubpredicates( subpredicates:Array<>) :NSPredicate;
+	// Subpredicates are evaluated in array order and evaluation stops once
+	// the result is decided, so order them cheapest and most selective first.
+	public static function andPredicateWithSubpredicates( subpredicates:Array<NSPredicate>) :NSPredicate;
+	public static function orPredicateWithSubpredicates( subpredicates:Array<NSPredicate>) :NSPredicate;
 	
 	public function subpredicates () :Array<NSPredicate>;
 	public function compoundPredicateType () :NSCompoundPredicateType;
 	public function initWithType (type:NSCompoundPredicateType, subpredicates:Array<NSPredicate>) :Dynamic;
 }
 
+@:framework("Foundation")
 extern enum NSCompoundPredicateType {
 	NSNotPredicateType;
 	NSAndPredicateType;
@@ -38,7 +38,8 @@ extern class NSData extends NSObject/* implements NSCopying, NSMutableCopying, N
 	// (NSExtendedData)
 	public function description () :String;
 	public function getBytes (buffer:Void, length:Int) :Void;
-	//public function getBytes (buffer:Void, range:NSRange) :Void;
+	//@:overload !!NEED CUSTOM META DATA !!
+	public function getBytes1 (buffer:Void, range:NSRange) :Void;
 	public function isEqualToData (other:NSData) :Bool;
 	public function subdataWithRange (range:NSRange) :NSData;
 	public function writeToFile (path:String, atomically:Bool) :Bool;
@@ -51,8 +52,12 @@ extern class NSData extends NSObject/* implements NSCopying, NSMutableCopying, N
 	public static function data () :NSData;
 	public static function dataWithBytes (bytes:Void, length:Int) :NSData;
 	public static function dataWithBytesNoCopy (bytes:Void, length:Int) :NSData;
-	//public static function dataWithBytesNoCopy (bytes:Void, length:Int, freeWhenDone:Bool) :NSData;
-	//public static function dataWithContentsOfFile (path:String, options:NSDataReadingOptions, error:NSError) :NSData;
+	// freeWhenDone:false wraps memory owned elsewhere, e.g. a slice of a larger buffer, without copying it
+	//@:overload !!NEED CUSTOM META DATA !!
+	public static function dataWithBytesNoCopy1 (bytes:Void, length:Int, freeWhenDone:Bool) :NSData;
+	// NSDataReadingMappedIfSafe maps the file instead of reading it into memory
+	//@:overload !!NEED CUSTOM META DATA !!
+	public static function dataWithContentsOfFile1 (path:String, options:NSDataReadingOptions, error:NSError) :NSData;
 	//public static function dataWithContentsOfURL (url:NSURL, options:NSDataReadingOptions, error:NSError) :NSData;
 	public static function dataWithContentsOfFile (string:String) :NSData;
 	public static function dataWithContentsOfURL (url:NSURL) :NSData;
@@ -88,6 +93,8 @@ extern class NSMutableData extends NSData {
 	//public function replaceBytesInRange (range:NSRange, withBytes:Void, length:Int) :Void;
 	
 	// (NSMutableDataCreation)
+	// Appending grows one contiguous buffer; create it with the expected
+	// capacity to avoid repeated grow-and-copy.
 	public static function dataWithCapacity (aNumItems:Int) :NSMutableData;
 	public static function dataWithLength (length:Int) :NSMutableData;
 	public function initWithCapacity (capacity:Int) :NSMutableData;
@@ -7,10 +7,15 @@ extern class NSDateFormatter extends NSFormatter
 	//Constants
 
 	//Static Methods
-	public function localizedStringFromDate( date:Date,  dstyle:NSDateFormatterStyle,  tstyle:NSDateFormatterStyle):String;
-	public function defaultFormatterBehavior():NSDateFormatterBehavior;
-	public function setDefaultFormatterBehavior( behavior:NSDateFormatterBehavior):Void;
-	public function dateFormatFromTemplate( tmplate:String,  opts:Int,  locale:NSLocale):String;
+	@:require(osx10_6)
+	@:require(ios4)
+	public static function localizedStringFromDate( date:Date,  dstyle:NSDateFormatterStyle,  tstyle:NSDateFormatterStyle):String;
+	public static function defaultFormatterBehavior():NSDateFormatterBehavior;
+	public static function setDefaultFormatterBehavior( behavior:NSDateFormatterBehavior):Void;
+	// no options defined, pass 0 for now
+	@:require(osx10_6)
+	@:require(ios4)
+	public static function dateFormatFromTemplate( tmplate:String,  opts:Int,  locale:NSLocale):String;
 
 	//Properties
 
@@ -63,6 +68,9 @@ extern class NSDateFormatter extends NSFormatter
 	public function setAMSymbol( string:String):Void;
 	public function setEraSymbols( array:Array<>):Void;
 	public function standaloneWeekdaySymbols():Array<>;
+	// setDateFormat compiles the pattern once; keep a configured formatter
+	// (fixed format, "en_US_POSIX" locale and time zone for machine
+	// timestamps) per thread and reuse it instead of creating one per call.
 	public function setDateFormat( string:String):Void;
 	public function defaultDate():Date;
 	public function shortStandaloneWeekdaySymbols():Array<>;
@@ -88,11 +96,22 @@ extern class NSDateFormatter extends NSFormatter
 	public function doesRelativeDateFormatting():Bool;
 }
 
+extern enum NSDateFormatterStyle
+{
+	NSDateFormatterNoStyle;
+	NSDateFormatterShortStyle;
+	NSDateFormatterMediumStyle;
+	NSDateFormatterLongStyle;
+	NSDateFormatterFullStyle;
+}
+
 extern enum NSDateFormatterBehavior
 {
 	NSDateFormatterBehaviorDefault;
-	#if;
-	#endif;
+	#if osx
+	NSDateFormatterBehavior10_0;
+	#end
+	NSDateFormatterBehavior10_4;
 }
 
 /*	NSDateFormatter.h
@@ -2,112 +2,118 @@
 	Copyright (c) 2004-2012, Apple Inc. All rights reserved.
 */
 
+package swift.foundation;
+
 import swift.foundation.NSObject;
+import haxe.extern.Rest;
 
+@:framework("Foundation")
+extern enum NSExpressionType {
+	NSConstantValueExpressionType; // Expression that always returns the same value
+	NSEvaluatedObjectExpressionType; // Expression that always returns the parameter object itself
+	NSVariableExpressionType; // Expression that always returns whatever is stored at 'variable' in the bindings dictionary
+	NSKeyPathExpressionType; // Expression that returns something that can be used as a key path
+	NSFunctionExpressionType; // Expression that returns the result of evaluating a symbol
+	NSUnionSetExpressionType; // Expression that returns the result of doing a unionSet: on two expressions that evaluate to flat collections (arrays or sets)
+	NSIntersectSetExpressionType; // Expression that returns the result of doing an intersectSet: on two expressions that evaluate to flat collections (arrays or sets)
+	NSMinusSetExpressionType; // Expression that returns the result of doing a minusSet: on two expressions that evaluate to flat collections (arrays or sets)
+	NSSubqueryExpressionType;
+	NSAggregateExpressionType;
+	NSBlockExpressionType;
+}
 
-typedef NS_ENUM(NSUInteger, NSExpressionType) {
-    NSConstantValueExpressionType = 0, // Expression that always returns the same value
-    NSEvaluatedObjectExpressionType, // Expression that always returns the parameter object itself
-    NSVariableExpressionType, // Expression that always returns whatever is stored at 'variable' in the bindings dictionary
-    NSKeyPathExpressionType, // Expression that returns something that can be used as a key path
-    NSFunctionExpressionType, // Expression that returns the result of evaluating a symbol
-    NSUnionSetExpressionType NS_ENUM_AVAILABLE(10_5, 3_0), // Expression that returns the result of doing a unionSet: on two expressions that evaluate to flat collections (arrays or sets)
-    NSIntersectSetExpressionType NS_ENUM_AVAILABLE(10_5, 3_0), // Expression that returns the result of doing an intersectSet: on two expressions that evaluate to flat collections (arrays or sets)
-    NSMinusSetExpressionType NS_ENUM_AVAILABLE(10_5, 3_0), // Expression that returns the result of doing a minusSet: on two expressions that evaluate to flat collections (arrays or sets)
-    NSSubqueryExpressionType NS_ENUM_AVAILABLE(10_5, 3_0) = 13,
-    NSAggregateExpressionType NS_ENUM_AVAILABLE(10_5, 3_0)
-#if NS_BLOCKS_AVAILABLE
-    ,
-    NSBlockExpressionType = 19
-#endif /* NS_BLOCKS_AVAILABLE */
-};
+/* Constant and variable expressions cost nothing to evaluate; key path
+   expressions go through valueForKeyPath on every evaluation, and
+   subquery and aggregate expressions loop over a collection each time.
+   Keep key paths short and prefer a direct key path comparison to a
+   SUBQUERY where the two are equivalent. */
 
-NS_CLASS_AVAILABLE(10_4, 3_0)
-extern class NSExpression : NSObject implements NSObject, NSCopying> {
-    @private
-    void *_reserved;
-    NSExpressionType _expressionType;
-}
+@:framework("Foundation")
+@:require(osx10_4)
+@:require(ios3)
+extern class NSExpression extends NSObject implements NSCoding implements NSCopying {
 
-+ (NSExpression *)expressionWithFormat:(NSString *)expressionFormat argumentArray:(NSArray *)arguments NS_AVAILABLE(10_6,4_0);
-+ (NSExpression *)expressionWithFormat:(NSString *)expressionFormat, ...  NS_AVAILABLE(10_6,4_0);
-+ (NSExpression *)expressionWithFormat:(NSString *)expressionFormat arguments:(va_list)argList NS_AVAILABLE(10_6,4_0);
+	//Static Methods
+	@:require(osx10_6) @:require(ios4) public static function expressionWithFormat( expressionFormat:String,  arguments:Array<Dynamic>):NSExpression;
+	//@:overload !!NEED CUSTOM META DATA !!
+	@:require(osx10_6) @:require(ios4) public static function expressionWithFormat1( expressionFormat:String,  rest:Rest<Dynamic>):NSExpression;
+	//public static function expressionWithFormat2( expressionFormat:String,  argList:va_list):NSExpression;
 
-+ (NSExpression *)expressionForConstantValue:(id)obj;    // Expression that returns a constant value
-+ (NSExpression *)expressionForEvaluatedObject;    // Expression that returns the object being evaluated
-+ (NSExpression *)expressionForVariable:(NSString *)string;    // Expression that pulls a value from the variable bindings dictionary
-+ (NSExpression *)expressionForKeyPath:(NSString *)keyPath;    // Expression that invokes valueForKeyPath with keyPath
-+ (NSExpression *)expressionForFunction:(NSString *)name arguments:(NSArray *)parameters;    // Expression that invokes one of the predefined functions. Will throw immediately if the selector is bad; will throw at runtime if the parameters are incorrect.
-    // Predefined functions are:
-    // name              parameter array contents				returns
+	public static function expressionForConstantValue( obj:Dynamic):NSExpression;    // Expression that returns a constant value
+	public static function expressionForEvaluatedObject():NSExpression;    // Expression that returns the object being evaluated
+	public static function expressionForVariable( string:String):NSExpression;    // Expression that pulls a value from the variable bindings dictionary
+	public static function expressionForKeyPath( keyPath:String):NSExpression;    // Expression that invokes valueForKeyPath with keyPath
+	public static function expressionForFunction( name:String,  parameters:Array<NSExpression>):NSExpression;    // Expression that invokes one of the predefined functions. Will throw immediately if the selector is bad; will throw at runtime if the parameters are incorrect.
+	// Predefined functions are:
+	// name              parameter array contents				returns
 	//-------------------------------------------------------------------------------------------------------------------------------------
-    // sum:              NSExpression instances representing numbers		NSNumber 
-    // count:            NSExpression instances representing numbers		NSNumber 
-    // min:              NSExpression instances representing numbers		NSNumber  
-    // max:              NSExpression instances representing numbers		NSNumber
-    // average:          NSExpression instances representing numbers		NSNumber
-    // median:           NSExpression instances representing numbers		NSNumber
-    // mode:             NSExpression instances representing numbers		NSArray	    (returned array will contain all occurrences of the mode)
-    // stddev:           NSExpression instances representing numbers		NSNumber
-    // add:to:           NSExpression instances representing numbers		NSNumber
-    // from:subtract:    two NSExpression instances representing numbers	NSNumber
-    // multiply:by:      two NSExpression instances representing numbers	NSNumber
-    // divide:by:        two NSExpression instances representing numbers	NSNumber
-    // modulus:by:       two NSExpression instances representing numbers	NSNumber
-    // sqrt:             one NSExpression instance representing numbers		NSNumber
-    // log:              one NSExpression instance representing a number	NSNumber
-    // ln:               one NSExpression instance representing a number	NSNumber
-    // raise:toPower:    one NSExpression instance representing a number	NSNumber
-    // exp:              one NSExpression instance representing a number	NSNumber
-    // floor:            one NSExpression instance representing a number	NSNumber
-    // ceiling:          one NSExpression instance representing a number	NSNumber
-    // abs:              one NSExpression instance representing a number	NSNumber
-    // trunc:            one NSExpression instance representing a number	NSNumber
-    // uppercase:	 one NSExpression instance representing a string	NSString
-    // lowercase:	 one NSExpression instance representing a string	NSString
-    // random            none							NSNumber (integer) 
-    // random:           one NSExpression instance representing a number	NSNumber (integer) such that 0 <= rand < param
-    // now               none							[NSDate now]
-    // bitwiseAnd:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
-    // bitwiseOr:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
-    // bitwiseXor:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
-    // leftshift:by:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
-    // rightshift:by:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
-    // onesComplement:	 one NSExpression instance representing a numbers	NSNumber    (numbers will be treated as NSInteger)
-    // noindex:		 an NSExpression					parameter   (used by CoreData to indicate that an index should be dropped)
+	// sum:              NSExpression instances representing numbers		NSNumber
+	// count:            NSExpression instances representing numbers		NSNumber
+	// min:              NSExpression instances representing numbers		NSNumber
+	// max:              NSExpression instances representing numbers		NSNumber
+	// average:          NSExpression instances representing numbers		NSNumber
+	// median:           NSExpression instances representing numbers		NSNumber
+	// mode:             NSExpression instances representing numbers		NSArray	    (returned array will contain all occurrences of the mode)
+	// stddev:           NSExpression instances representing numbers		NSNumber
+	// add:to:           NSExpression instances representing numbers		NSNumber
+	// from:subtract:    two NSExpression instances representing numbers	NSNumber
+	// multiply:by:      two NSExpression instances representing numbers	NSNumber
+	// divide:by:        two NSExpression instances representing numbers	NSNumber
+	// modulus:by:       two NSExpression instances representing numbers	NSNumber
+	// sqrt:             one NSExpression instance representing numbers		NSNumber
+	// log:              one NSExpression instance representing a number	NSNumber
+	// ln:               one NSExpression instance representing a number	NSNumber
+	// raise:toPower:    one NSExpression instance representing a number	NSNumber
+	// exp:              one NSExpression instance representing a number	NSNumber
+	// floor:            one NSExpression instance representing a number	NSNumber
+	// ceiling:          one NSExpression instance representing a number	NSNumber
+	// abs:              one NSExpression instance representing a number	NSNumber
+	// trunc:            one NSExpression instance representing a number	NSNumber
+	// uppercase:	 one NSExpression instance representing a string	NSString
+	// lowercase:	 one NSExpression instance representing a string	NSString
+	// random            none							NSNumber (integer)
+	// random:           one NSExpression instance representing a number	NSNumber (integer) such that 0 <= rand < param
+	// now               none							[NSDate now]
+	// bitwiseAnd:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
+	// bitwiseOr:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
+	// bitwiseXor:with:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
+	// leftshift:by:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
+	// rightshift:by:	 two NSExpression instances representing numbers	NSNumber    (numbers will be treated as NSInteger)
+	// onesComplement:	 one NSExpression instance representing a numbers	NSNumber    (numbers will be treated as NSInteger)
+	// noindex:		 an NSExpression					parameter   (used by CoreData to indicate that an index should be dropped)
 
-+ (NSExpression *)expressionForAggregate:(NSArray *)subexpressions NS_AVAILABLE(10_5, 3_0); // Expression that returns a collection containing the results of other expressions
-+ (NSExpression *)expressionForUnionSet:(NSExpression *)left with:(NSExpression *)right NS_AVAILABLE(10_5, 3_0); // return an expression that will return the union of the collections expressed by left and right
-+ (NSExpression *)expressionForIntersectSet:(NSExpression *)left with:(NSExpression *)right NS_AVAILABLE(10_5, 3_0); // return an expression that will return the intersection of the collections expressed by left and right
-+ (NSExpression *)expressionForMinusSet:(NSExpression *)left with:(NSExpression *)right NS_AVAILABLE(10_5, 3_0); // return an expression that will return the disjunction of the collections expressed by left and right
-+ (NSExpression *)expressionForSubquery:(NSExpression *)expression usingIteratorVariable:(NSString *)variable predicate:(id)predicate NS_AVAILABLE(10_5, 3_0); // Expression that filters a collection by storing elements in the collection in the variable variable and keeping the elements for which qualifer returns true; variable is used as a local variable, and will shadow any instances of variable in the bindings dictionary, the variable is removed or the old value replaced once evaluation completes
-+ (NSExpression *)expressionForFunction:(NSExpression *)target selectorName:(NSString *)name arguments:(NSArray *)parameters NS_AVAILABLE(10_5, 3_0);    // Expression that invokes the selector on target with parameters. Will throw at runtime if target does not implement selector or if parameters are wrong.
+	@:require(osx10_5) @:require(ios3) public static function expressionForAggregate( subexpressions:Array<NSExpression>):NSExpression; // Expression that returns a collection containing the results of other expressions
+	@:require(osx10_5) @:require(ios3) public static function expressionForUnionSet( left:NSExpression,  right:NSExpression):NSExpression; // return an expression that will return the union of the collections expressed by left and right
+	@:require(osx10_5) @:require(ios3) public static function expressionForIntersectSet( left:NSExpression,  right:NSExpression):NSExpression; // return an expression that will return the intersection of the collections expressed by left and right
+	@:require(osx10_5) @:require(ios3) public static function expressionForMinusSet( left:NSExpression,  right:NSExpression):NSExpression; // return an expression that will return the disjunction of the collections expressed by left and right
+	// Expression that filters a collection by storing elements in the collection in the variable variable and keeping the elements for which qualifer returns true; variable is used as a local variable, and will shadow any instances of variable in the bindings dictionary, the variable is removed or the old value replaced once evaluation completes
+	@:require(osx10_5) @:require(ios3) public static function expressionForSubquery( expression:NSExpression,  variable:String,  predicate:Dynamic):NSExpression;
+	//@:overload !!NEED CUSTOM META DATA !!
+	// Expression that invokes the selector on target with parameters. Will throw at runtime if target does not implement selector or if parameters are wrong.
+	@:require(osx10_5) @:require(ios3) public static function expressionForFunction1( target:NSExpression,  name:String,  parameters:Array<NSExpression>):NSExpression;
 
-#if NS_BLOCKS_AVAILABLE
-+ (NSExpression *)expressionForBlock:(id (^)(id evaluatedObject, NSArray *expressions, NSMutableDictionary *context))block arguments:(NSArray *)arguments NS_AVAILABLE(10_6, 4_0); // Expression that invokes the block with the parameters; note that block expressions are not encodable or representable as parseable strings.
-#endif
+	// Expression that invokes the block with the parameters; note that block expressions are not encodable or representable as parseable strings.
+	@:require(osx10_6) @:require(ios4) public static function expressionForBlock( block:Dynamic->Array<NSExpression>->NSMutableDictionary->Dynamic,  arguments:Array<NSExpression>):NSExpression;
 
-- (id)initWithExpressionType:(NSExpressionType)type;    // designated initializer
+	//Methods
+	public function initWithExpressionType( type:NSExpressionType):Dynamic;    // designated initializer
 
-// accessors for individual parameters - raise if not applicable
-- (NSExpressionType)expressionType;
-- (id)constantValue;
-- (NSString *)keyPath;
-- (NSString *)function;
-- (NSString *)variable;
-- (NSExpression *)operand;    // the object on which the selector will be invoked (the result of evaluating a key path or one of the defined functions)
-- (NSArray *)arguments;    // array of expressions which will be passed as parameters during invocation of the selector on the operand of a function expression
+	// accessors for individual parameters - raise if not applicable
+	public function expressionType():NSExpressionType;
+	public function constantValue():Dynamic;
+	public function keyPath():String;
+	@:native("function") public function function_():String;
+	public function variable():String;
+	public function operand():NSExpression;    // the object on which the selector will be invoked (the result of evaluating a key path or one of the defined functions)
+	public function arguments():Array<NSExpression>;    // array of expressions which will be passed as parameters during invocation of the selector on the operand of a function expression
 
-- (id)collection NS_AVAILABLE(10_5, 3_0);
-- (NSPredicate *)predicate NS_AVAILABLE(10_5, 3_0);
-- (NSExpression *)leftExpression NS_AVAILABLE(10_5, 3_0); // expression which represents the left side of a set expression
-- (NSExpression *)rightExpression NS_AVAILABLE(10_5, 3_0); // expression which represents the right side of a set expression
+	@:require(osx10_5) @:require(ios3) public function collection():Dynamic;
+	@:require(osx10_5) @:require(ios3) public function predicate():NSPredicate;
+	@:require(osx10_5) @:require(ios3) public function leftExpression():NSExpression; // expression which represents the left side of a set expression
+	@:require(osx10_5) @:require(ios3) public function rightExpression():NSExpression; // expression which represents the right side of a set expression
 
-#if NS_BLOCKS_AVAILABLE
-- (id (^)(id, NSArray *, NSMutableDictionary *))expressionBlock NS_AVAILABLE(10_6, 4_0);
-#endif /* NS_BLOCKS_AVAILABLE */
+	@:require(osx10_6) @:require(ios4) public function expressionBlock():Dynamic->Array<NSExpression>->NSMutableDictionary->Dynamic;
 
-// evaluate the expression using the object and bindings- note that context is mutable here and can be used by expressions to store temporary state for one predicate evaluation
-- (id)expressionValueWithObject:(id)object context:(NSMutableDictionary *)context;
+	// evaluate the expression using the object and bindings- note that context is mutable here and can be used by expressions to store temporary state for one predicate evaluation
+	public function expressionValueWithObject( object:Dynamic,  context:NSMutableDictionary):Dynamic;
 }
-
@@ -78,9 +78,15 @@ extern class NSFileManager extends NSObject {
 	public function componentsToDisplayForPath (path:String) :Array<String>;
 	public function enumeratorAtPath (path:String) :NSDirectoryEnumerator;
 
-/*#if NS_BLOCKS_AVAILABLE
-- (NSDirectoryEnumerator *)enumeratorAtURL:(NSURL *)url includingPropertiesForKeys:(Array<> *)keys options:(NSDirectoryEnumerationOptions)mask errorHandler:(Bool (^)(NSURL *url, NSError *error))handler NS_AVAILABLE(10_6, 4_0);
-#end*/
+
+/* The keys are fetched in bulk with each directory read and cached on the
+   returned URLs, so pass only the keys the walk will actually look at.
+   Enumerators do not share state: a large tree can be walked in parallel by
+   listing the top level with contentsOfDirectoryAtURL and handing each
+   subdirectory to its own enumerator on a separate queue. */
+	@:require(osx10_6)
+	@:require(ios4)
+	public function enumeratorAtURL (url:NSURL, includingPropertiesForKeys:Array<String>, options:NSDirectoryEnumerationOptions, errorHandler:NSURL->NSError->Bool) :NSDirectoryEnumerator;
 
 	public function subpathsAtPath (path:String) :Array<String>;
 	public function contentsAtPath (path:String) :NSData;
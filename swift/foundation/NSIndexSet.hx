@@ -2,8 +2,13 @@ package swift.foundation;
 import swift.foundation.NSObject;
 import swift.foundation.NSArray;//NSEnumerationOptions
 
-private typedef NSSortOptions = Dynamic;
-private typedef NSComparator = Dynamic;
+/* An index set is stored as a sorted list of ranges, so its size and the
+   cost of most operations follow the number of runs, not the number of
+   indexes. Contiguous selections are cheap at any size; scattered ones cost
+   a range each. Build sets from ranges (addIndexesInRange) where possible,
+   combine whole sets with addIndexes/removeIndexes instead of looping over
+   single indexes, and walk large sets with enumerateRangesUsingBlock so
+   each run is handled once. */
 
 @:framework("Foundation")
 extern class NSIndexSet extends NSObject implements NSCopying implements NSMutableCopying implements NSCoding
@@ -12,50 +17,68 @@ extern class NSIndexSet extends NSObject implements NSCopying implements NSMutab
 	//Constants
 
 	//Static Methods
-	public function indexSetWithIndexesInRange( range:NSRange):Dynamic;
-	public function indexSetWithIndex( value:Int):Dynamic;
-	public function indexSet():Dynamic;
+	public static function indexSet():Dynamic;
+	public static function indexSetWithIndex( value:Int):Dynamic;
+	public static function indexSetWithIndexesInRange( range:NSRange):Dynamic;
 
 	//Properties
 
 	//Methods
-	public function indexPassingTest( predicate:Dynamic):Int;
-	public function indexGreaterThanIndex( value:Int):Int;
-	public function removeAllIndexes():Void;
+	override public function init():Dynamic;
 	public function initWithIndex( value:Int):Dynamic;
-	public function enumerateIndexesWithOptions( opts:NSEnumerationOptions,  block:Dynamic):Void;
-	public function indexesInRange( range:NSRange,  opts:NSEnumerationOptions,  predicate:Dynamic):NSIndexSet;
-	public function removeIndexes( indexSet:NSIndexSet):Void;
-	public function removeIndexesInRange( range:NSRange):Void;
-	//public function getIndexes( indexBuffer:Int,  bufferSize:Int,  range:NSRangePointer):Int;
-	public function countOfIndexesInRange( range:NSRange):Int;
-	public function indexesPassingTest( predicate:Dynamic):NSIndexSet;
-	public function count():Int;
-	public function containsIndex( value:Int):Bool;
-	public function initWithIndexSet( indexSet:NSIndexSet):Dynamic;
-	public function indexLessThanIndex( value:Int):Int;
-	public function enumerateRangesWithOptions( opts:NSEnumerationOptions,  block:Dynamic):Void;
-	public function removeIndex( value:Int):Void;
-	public function addIndexes( indexSet:NSIndexSet):Void;
-	public function enumerateRangesUsingBlock( block:Dynamic):Void;
-	public function indexWithOptions( opts:NSEnumerationOptions,  predicate:Dynamic):Int;
-	public function indexInRange( range:NSRange,  opts:NSEnumerationOptions,  predicate:Dynamic):Int;
-	public function enumerateRangesInRange( range:NSRange,  opts:NSEnumerationOptions,  block:Dynamic):Void;
-	public function containsIndexes( indexSet:NSIndexSet):Bool;
-	public function enumerateIndexesInRange( range:NSRange,  opts:NSEnumerationOptions,  block:Dynamic):Void;
-	public function addIndex( value:Int):Void;
-	public function indexLessThanOrEqualToIndex( value:Int):Int;
-	public function shiftIndexesStartingAtIndex( index:Int,  delta:Int):Void;
-	public function lastIndex():Int;
-	public function intersectsIndexesInRange( range:NSRange):Bool;
-	public function indexesWithOptions( opts:NSEnumerationOptions,  predicate:Dynamic):NSIndexSet;
 	public function initWithIndexesInRange( range:NSRange):Dynamic;
-	public function firstIndex():Int;
+	public function initWithIndexSet( indexSet:NSIndexSet):Dynamic;
+
 	public function isEqualToIndexSet( indexSet:NSIndexSet):Bool;
+
+	public function count():Int;
+
+	public function firstIndex():Int;
+	public function lastIndex():Int;
+	public function indexGreaterThanIndex( value:Int):Int;
+	public function indexLessThanIndex( value:Int):Int;
 	public function indexGreaterThanOrEqualToIndex( value:Int):Int;
-	public function addIndexesInRange( range:NSRange):Void;
-	public function enumerateIndexesUsingBlock( block:Dynamic):Void;
+	public function indexLessThanOrEqualToIndex( value:Int):Int;
+
+	//public function getIndexes( indexBuffer:Int,  bufferSize:Int,  range:NSRangePointer):Int;
+
+	@:require(osx10_5) @:require(ios2) public function countOfIndexesInRange( range:NSRange):Int;
+
+	public function containsIndex( value:Int):Bool;
 	public function containsIndexesInRange( range:NSRange):Bool;
-	override public function init():Dynamic;
+	public function containsIndexes( indexSet:NSIndexSet):Bool;
+	public function intersectsIndexesInRange( range:NSRange):Bool;
+
+	// NSEnumerationConcurrent lets the block run for several indexes at
+	// once; the block must then be safe to call from multiple threads.
+	@:require(osx10_6) @:require(ios4) public function enumerateIndexesUsingBlock( block:Int->Bool->Void):Void;
+	@:require(osx10_6) @:require(ios4) public function enumerateIndexesWithOptions( opts:NSEnumerationOptions,  block:Int->Bool->Void):Void;
+	@:require(osx10_6) @:require(ios4) public function enumerateIndexesInRange( range:NSRange,  opts:NSEnumerationOptions,  block:Int->Bool->Void):Void;
+
+	@:require(osx10_6) @:require(ios4) public function indexPassingTest( predicate:Int->Bool->Bool):Int;
+	@:require(osx10_6) @:require(ios4) public function indexWithOptions( opts:NSEnumerationOptions,  predicate:Int->Bool->Bool):Int;
+	@:require(osx10_6) @:require(ios4) public function indexInRange( range:NSRange,  opts:NSEnumerationOptions,  predicate:Int->Bool->Bool):Int;
+
+	@:require(osx10_6) @:require(ios4) public function indexesPassingTest( predicate:Int->Bool->Bool):NSIndexSet;
+	@:require(osx10_6) @:require(ios4) public function indexesWithOptions( opts:NSEnumerationOptions,  predicate:Int->Bool->Bool):NSIndexSet;
+	@:require(osx10_6) @:require(ios4) public function indexesInRange( range:NSRange,  opts:NSEnumerationOptions,  predicate:Int->Bool->Bool):NSIndexSet;
+
+	@:require(osx10_7) @:require(ios5) public function enumerateRangesUsingBlock( block:NSRange->Bool->Void):Void;
+	@:require(osx10_7) @:require(ios5) public function enumerateRangesWithOptions( opts:NSEnumerationOptions,  block:NSRange->Bool->Void):Void;
+	@:require(osx10_7) @:require(ios5) public function enumerateRangesInRange( range:NSRange,  opts:NSEnumerationOptions,  block:NSRange->Bool->Void):Void;
 }
 
+@:framework("Foundation")
+extern class NSMutableIndexSet extends NSIndexSet
+{
+	public function addIndexes( indexSet:NSIndexSet):Void;
+	public function removeIndexes( indexSet:NSIndexSet):Void;
+	public function removeAllIndexes():Void;
+	public function addIndex( value:Int):Void;
+	public function removeIndex( value:Int):Void;
+	public function addIndexesInRange( range:NSRange):Void;
+	public function removeIndexesInRange( range:NSRange):Void;
+
+	// For a sequence of insertions or deletions at and above index.
+	public function shiftIndexesStartingAtIndex( index:Int,  delta:Int):Void;
+}
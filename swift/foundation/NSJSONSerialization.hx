@@ -35,7 +35,16 @@ extern class NSJSONSerialization extends NSObject {
 	/* Create a Foundation object from JSON data. Set the NSJSONReadingAllowFragments option if the parser should allow top-level objects that are not an Array<> or NSDictionary. Setting the NSJSONReadingMutableContainers option will make the parser generate mutable Array<>s and NSDictionaries. Setting the NSJSONReadingMutableLeaves option will make the parser generate mutable NSString objects. If an error occurs during the parse, then the error parameter will be set and the result will be nil.
 	   The data must be in one of the 5 supported encodings listed in the JSON specification: UTF-8, UTF-16LE, UTF-16BE, UTF-32LE, UTF-32BE. The data may or may not have a BOM. The most efficient encoding to use for parsing is UTF-8, so if you have a choice in encoding the data passed to this method, use UTF-8.
 	 */
-	public static function JSONObjectWithData( data:NSData, options:NSJSONReadingOptions, error:NSError) :NSJSONSerialization;
+	/* The whole object tree is built before this returns, so peak memory is
+	   the payload plus every object in it. For large payloads map the file
+	   (dataWithContentsOfFile1 with NSDataReadingMappedIfSafe) instead of
+	   reading it, and leave out the mutable options unless the tree will be
+	   edited, since they make the parser create mutable containers and
+	   strings.
+	   Newline-delimited feeds are best parsed a line at a time with
+	   subdataWithRange, letting each record's objects go before the next.
+	 */
+	public static function JSONObjectWithData( data:NSData, options:NSJSONReadingOptions, error:NSError) :Dynamic;
 	
 	/* Write JSON data into a stream. The stream should be opened and configured. The return value is the number of bytes written to the stream, or 0 on error. All other behavior of this method is the same as the dataWithJSONObject:options:error: method.
 	 */
@@ -43,7 +52,7 @@ extern class NSJSONSerialization extends NSObject {
 	
 	/* Create a JSON object from JSON data stream. The stream should be opened and configured. All other behavior of this method is the same as the JSONObjectWithData:options:error: method.
 	 */
-	public static function JSONObjectWithStream( stream:NSInputStream, options:NSJSONReadingOptions, error:NSError) :NSJSONSerialization;
+	public static function JSONObjectWithStream( stream:NSInputStream, options:NSJSONReadingOptions, error:NSError) :Dynamic;
 	
 }
 
@@ -1,76 +1,118 @@
 package swift.foundation;
 
+import swift.foundation.NSObject;
 
-extern class NSKeyedArchiver extends NSCoder
-{
+/* A keyed archive is a property list holding every encoded object as its
+   own dictionary of keys to values or object references, and the whole
+   graph is built in memory before it is written out. For documents made
+   of many small records, per-object overhead dominates: encode runs of
+   plain values (coordinates, samples, flags) as one block with
+   encodeBytes instead of one object each, keep keys short, and let the
+   binary output format (the default) unique repeated key and class name
+   strings. */
+
+@:framework("Foundation")
+extern class NSKeyedArchiver extends NSCoder {
 
 	//Constants
-	static public inline var _bytes:*;
+	public static var NSInvalidArchiveOperationException :String;
 
 	//Static Methods
-	public function archiveRootObject( rootObject:Dynamic,  path:String):Bool;
-	public function classNameForClass( cls:Class):String;
-	public function setClass( cls:Class,  codedName:String):Void;
-	public function classForKeyedUnarchiver():Class;
-	public function setClassName( codedName:String,  cls:Class):Void;
-	public function classForClassName( codedName:String):Class;
-	public function unarchiveObjectWithFile( path:String):Dynamic;
-	public function classFallbacksForKeyedArchiver():Array<>;
-	public function archivedDataWithRootObject( rootObject:Dynamic):NSData;
-	public function unarchiveObjectWithData( data:NSData):Dynamic;
-
-	//Properties
+	public static function archivedDataWithRootObject( rootObject:Dynamic):NSData;
+	public static function archiveRootObject( rootObject:Dynamic,  path:String):Bool;
+
+	// During encoding, the coder first checks with the coder's
+	// own table, then if there was no mapping there, the class's.
+	public static function setClassName( codedName:String,  cls:Class):Void;
+	public static function classNameForClass( cls:Class):String;
 
 	//Methods
-	public override function encodeInt64( intv:int64_t,  key:String):Void;
-	public function unarchiver( unarchiver:NSKeyedUnarchiver,  name:String,  classNames:Array<>):Class;
+	public function initForWritingWithMutableData( data:NSMutableData):Dynamic;
+
+	public function setDelegate( delegate:NSKeyedArchiverDelegate):Void;
+	public function delegate():NSKeyedArchiverDelegate;
+
+	public function setOutputFormat( format:NSPropertyListFormat):Void;
+	public function outputFormat():NSPropertyListFormat;
+
+	public function finishEncoding():Void;
+
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function unarchiver1( unarchiver:NSKeyedUnarchiver,  NS_RELEASES_ARGUMENT:Dynamic):Dynamic;
+	public function setClassName1( codedName:String,  cls:Class):Void;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function unarchiver2( unarchiver:NSKeyedUnarchiver,  object:Dynamic,  newObject:Dynamic):Void;
-	public function classForClassName( codedName:String):Class;
-	public override function decodeObjectForKey( key:String):Dynamic;
-	public override function containsValueForKey( key:String):Bool;
-	public override function decodeInt32ForKey( key:String):int32_t;
-	public override function encodeBytes( bytesp:constuint8_t,  lenv:Int,  key:String):Void;
-	public override function decodeInt64ForKey( key:String):int64_t;
-	public function classForKeyedArchiver():Class;
-	public function initForWritingWithMutableData( data:NSMutableData):Dynamic;
-	public function setDelegate( delegate:id<NSKeyedArchiverDelegate>):Void;
+	public function classNameForClass1( cls:Class):String;
+
+	// Encodes lenv bytes as a single value; decodeBytesForKey hands them back
+	// without creating an object per element.
+	public function encodeBytes( bytesp:Dynamic,  lenv:Int,  key:String):Void;
+}
+
+/* Decoding reads the whole archive up front and materializes an object
+   the first time a key that refers to it is decoded. Objects no key is
+   ever decoded for are not created, so an initWithCoder that skips
+   optional keys also skips their subgraphs. */
+
+@:framework("Foundation")
+extern class NSKeyedUnarchiver extends NSCoder {
+
+	//Constants
+	public static var NSInvalidUnarchiveOperationException :String;
+
+	//Static Methods
+	public static function unarchiveObjectWithData( data:NSData):Dynamic;
+	public static function unarchiveObjectWithFile( path:String):Dynamic;
+
+	// During decoding, the coder first checks with the coder's
+	// own table, then if there was no mapping there, the class's.
+	public static function setClass( cls:Class,  codedName:String):Void;
+	public static function classForClassName( codedName:String):Class;
+
+	//Methods
+	public function initForReadingWithData( data:NSData):Dynamic;
+
+	public function setDelegate( delegate:NSKeyedUnarchiverDelegate):Void;
+	public function delegate():NSKeyedUnarchiverDelegate;
+
+	public function finishDecoding():Void;
+
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function setDelegate1( delegate:id<NSKeyedUnarchiverDelegate>):Void;
-	public function delegate():id<NSKeyedArchiverDelegate>;
+	public function setClass1( cls:Class,  codedName:String):Void;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function delegate1():id<NSKeyedUnarchiverDelegate>;
-	public function setClassName( codedName:String,  cls:Class):Void;
-	public override function decodeDoubleForKey( key:String):Float;
+	public function classForClassName1( codedName:String):Class;
+
+	// Returned bytes are immutable, and they go away with the unarchiver,
+	// not the containing autorelease pool.
+	public function decodeBytesForKey( key:String,  lengthp:Int):Dynamic;
+}
+
+@:framework("Foundation")
+extern interface NSKeyedArchiverDelegate {
+#if display
+	// willEncodeObject:
 	public function archiver( archiver:NSKeyedArchiver,  object:Dynamic):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
+	// didEncodeObject:
 	public function archiver1( archiver:NSKeyedArchiver,  object:Dynamic):Void;
 	//@:overload !!NEED CUSTOM META DATA !!
+	// willReplaceObject:withObject:
 	public function archiver2( archiver:NSKeyedArchiver,  object:Dynamic,  newObject:Dynamic):Void;
-	public override function decodeIntForKey( key:String):Int;
 	public function archiverWillFinish( archiver:NSKeyedArchiver):Void;
-	public function finishEncoding():Void;
-	public override function encodeFloat( realv:Float,  key:String):Void;
-	public override function decodeBoolForKey( key:String):Bool;
 	public function archiverDidFinish( archiver:NSKeyedArchiver):Void;
-	public override function encodeConditionalObject( objv:Dynamic,  key:String):Void;
-	public function finishDecoding():Void;
+#end
+}
+
+@:framework("Foundation")
+extern interface NSKeyedUnarchiverDelegate {
+#if display
+	// cannotDecodeObjectOfClassName:originalClasses:
+	public function unarchiver( unarchiver:NSKeyedUnarchiver,  name:String,  classNames:Array<String>):Class;
+	//@:overload !!NEED CUSTOM META DATA !!
+	// didDecodeObject:
+	public function unarchiver1( unarchiver:NSKeyedUnarchiver,  object:Dynamic):Dynamic;
+	//@:overload !!NEED CUSTOM META DATA !!
+	// willReplaceObject:withObject:
+	public function unarchiver2( unarchiver:NSKeyedUnarchiver,  object:Dynamic,  newObject:Dynamic):Void;
 	public function unarchiverWillFinish( unarchiver:NSKeyedUnarchiver):Void;
-	public override function encodeInt( intv:Int,  key:String):Void;
-	public override function encodeDouble( realv:Float,  key:String):Void;
-	public function initForReadingWithData( data:NSData):Dynamic;
 	public function unarchiverDidFinish( unarchiver:NSKeyedUnarchiver):Void;
-	public override function encodeBool( boolv:Bool,  key:String):Void;
-	public override function decodeFloatForKey( key:String):Float;
-	public override function encodeObject( objv:Dynamic,  key:String):Void;
-	public override function decodeBytesForKey( key:String,  lengthp:Int):constuint8_t;
-	public function setOutputFormat( format:NSPropertyListFormat):Void;
-	public function classNameForClass( cls:Class):String;
-	public function setClass( cls:Class,  codedName:String):Void;
-	public function replacementObjectForKeyedArchiver( archiver:NSKeyedArchiver):Dynamic;
-	public function outputFormat():NSPropertyListFormat;
-	public override function encodeInt32( intv:int32_t,  key:String):Void;
+#end
 }
-
@@ -1,5 +1,6 @@
 package swift.foundation;
 import swift.foundation.NSObject;
+import swift.foundation.NSOperation;
 
 extern class NSNotification extends NSObject implements NSCopying implements NSCoding {
 
@@ -25,8 +26,14 @@ extern class NSNotificationCenter extends NSObject {
 	//public function postNotificationName (aName:String, object:Dynamic, userInfo:NSDictionary) :Void;
 
 	public function removeObserver (observer:Dynamic) :Void;
-	//public function removeObserver (observer:Dynamic, name:String, object:Dynamic) :Void;
-
-//- (id)addObserverForName:(NSString *)name object:(id)obj queue:(NSOperationQueue *)queue usingBlock:(void (^)(NSNotification *note))block NS_AVAILABLE(10_6, 4_0);
+	//@:overload !!NEED CUSTOM META DATA !!
+	public function removeObserver1 (observer:Dynamic, name:String, object:Dynamic) :Void;
+
+/* The block runs on `queue', or on the posting thread when `queue' is nil.
+   A nil name makes the observer a candidate for every post, so pass one
+   whenever it is known. */
+	@:require(osx10_6)
+	@:require(ios4)
+	public function addObserverForName (name:String, object:Dynamic, queue:NSOperationQueue, usingBlock:NSNotification->Void) :Dynamic;
 }
 
@@ -1,6 +1,18 @@
 package swift.foundation;
 
+import swift.foundation.NSObject;
 
+typedef NSPostingStyle = Int;
+
+/* Each coalescing enqueue is compared against the notifications already
+   waiting in the queue, so the queue should stay short. For bursts of
+   change notifications, enqueue one notification per kind of change with
+   NSPostASAP or NSPostWhenIdle and coalesce on name and sender; carry the
+   changed objects in a collection the observers read when the single
+   coalesced notification is delivered, instead of one notification per
+   object. */
+
+@:framework("Foundation")
 extern class NSNotificationQueue extends NSObject {
 
 	//Constants
@@ -11,17 +23,17 @@ extern class NSNotificationQueue extends NSObject {
 	inline public static var NSNotificationNoCoalescing = 0;
 	inline public static var NSNotificationCoalescingOnName = 1;
 	inline public static var NSNotificationCoalescingOnSender = 2;
-	
+
 	//Static Methods
 	public static function defaultQueue():NSNotificationQueue;
 
 	//Properties
 
 	//Methods
+	public function initWithNotificationCenter(notificationCenter:NSNotificationCenter) :NSNotificationQueue;
+
 	public function enqueueNotification(notification:NSNotification, postingStyle:NSPostingStyle) :Void;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function enqueueNotification1( notification:NSNotification, postingStyle:NSPostingStyle, coalesceMask:Int, forModes:Array<>) :Void;
+	public function enqueueNotification1( notification:NSNotification, postingStyle:NSPostingStyle, coalesceMask:Int, forModes:Array<String>) :Void;
 	public function dequeueNotificationsMatching(notification:NSNotification, coalesceMask:Int) :Void;
-	
-	public function initWithNotificationCenter(notificationCenter:NSNotificationCenter) :NSNotificationQueue;
 }
@@ -7,9 +7,15 @@ extern class NSNumberFormatter extends NSFormatter
 	//Constants
 
 	//Static Methods
-	public function localizedStringFromNumber( num:Float,  nstyle:NSNumberFormatterStyle):String;
-	public function defaultFormatterBehavior():NSNumberFormatterBehavior;
-	public function setDefaultFormatterBehavior( behavior:NSNumberFormatterBehavior):Void;
+	// Formats with a formatter Foundation keeps per style for the current
+	// locale. For repeated formatting with custom settings, create one
+	// formatter per thread, locale and style and reuse it; setting it up
+	// costs far more than formatting a single number.
+	@:require(osx10_6)
+	@:require(ios4)
+	public static function localizedStringFromNumber( num:Float,  nstyle:NSNumberFormatterStyle):String;
+	public static function defaultFormatterBehavior():NSNumberFormatterBehavior;
+	public static function setDefaultFormatterBehavior( behavior:NSNumberFormatterBehavior):Void;
 
 	//Properties
 
@@ -160,8 +166,10 @@ extern enum NSNumberFormatterStyle
 extern enum NSNumberFormatterBehavior
 {
 	NSNumberFormatterBehaviorDefault;
-	#if;
-	#endif;
+	#if osx
+	NSNumberFormatterBehavior10_0;
+	#end
+	NSNumberFormatterBehavior10_4;
 }
 
 extern enum NSNumberFormatterPadPosition
@@ -86,6 +86,16 @@ extern class NSObject {
 	public function replacementObjectForCoder (aCoder:NSCoder) :NSObject;
 	public function awakeAfterUsingCoder (aDecoder:NSCoder) :NSObject;
 
+	// NSKeyedArchiverObjectSubstitution
+
+	public function classForKeyedArchiver () :Class<Dynamic>;
+	public function replacementObjectForKeyedArchiver (archiver:NSKeyedArchiver) :Dynamic;
+	public static function classFallbacksForKeyedArchiver () :Array<String>;
+
+	// NSKeyedUnarchiverObjectSubstitution
+
+	public static function classForKeyedUnarchiver () :Class<Dynamic>;
+
 //	(UIResponderStandardEditActions)   // these methods are not implemented in NSObject
 
 /*		public function cut:(id)sender NS_AVAILABLE_IOS(3_0);
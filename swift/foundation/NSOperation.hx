@@ -4,6 +4,9 @@
 
 package swift.foundation;
 
+import swift.foundation.NSObject;
+
+@:framework("Foundation")
 extern enum NSOperationQueuePriority {
 	NSOperationQueuePriorityVeryLow;
 	NSOperationQueuePriorityLow;
@@ -12,116 +15,108 @@ extern enum NSOperationQueuePriority {
 	NSOperationQueuePriorityVeryHigh;
 }
 
+@:framework("Foundation")
 extern class NSOperation extends NSObject {
 
-- (id)init; // designated initializer
-
-public function start;
-public function main;
-
-- (Bool)isCancelled;
-public function cancel;
-
-- (Bool)isExecuting;
-- (Bool)isFinished;
-
-- (Bool)isConcurrent;
+	public function init () :NSOperation; // designated initializer
 
-- (Bool)isReady;
+	public function start () :Void;
+	public function main () :Void;
 
-public function addDependency:(NSOperation *)op;
-public function removeDependency:(NSOperation *)op;
+	// Cancelling does not stop a running operation; main should check
+	// isCancelled at convenient points and return early. A cancelled
+	// operation still counts as finished for the operations depending on it.
+	public function isCancelled () :Bool;
+	public function cancel () :Void;
 
-- (Array<> *)dependencies;
+	public function isExecuting () :Bool;
+	public function isFinished () :Bool;
+	public function isConcurrent () :Bool;
+	public function isReady () :Bool;
 
+	// Add dependencies before the operation is put on a queue. An operation
+	// only becomes ready once all of its dependencies have finished, so a
+	// graph of operations can be handed to the queue in one
+	// addOperations call and runs in dependency order.
+	public function addDependency (op:NSOperation) :Void;
+	public function removeDependency (op:NSOperation) :Void;
+	public function dependencies () :Array<NSOperation>;
 
-- (NSOperationQueuePriority)queuePriority;
-public function setQueuePriority:(NSOperationQueuePriority)p;
+	// Priority only orders operations that are ready at the same time;
+	// it never lets an operation run ahead of its dependencies.
+	public function queuePriority () :NSOperationQueuePriority;
+	public function setQueuePriority (p:NSOperationQueuePriority) :Void;
 
-#if NS_BLOCKS_AVAILABLE
-- (void (^)(void))completionBlock NS_AVAILABLE(10_6, 4_0);
-public function setCompletionBlock:(void (^)(void))block NS_AVAILABLE(10_6, 4_0);
-#endif
+	@:require(osx10_6) @:require(ios4) public function completionBlock () :Void->Void;
+	@:require(osx10_6) @:require(ios4) public function setCompletionBlock (block:Void->Void) :Void;
 
-public function waitUntilFinished NS_AVAILABLE(10_6, 4_0);
-
-- (double)threadPriority NS_AVAILABLE(10_6, 4_0);
-public function setThreadPriority:(double)p NS_AVAILABLE(10_6, 4_0);
+	@:require(osx10_6) @:require(ios4) public function waitUntilFinished () :Void;
 
+	@:require(osx10_6) @:require(ios4) public function threadPriority () :Float;
+	@:require(osx10_6) @:require(ios4) public function setThreadPriority (p:Float) :Void;
 }
 
-
-
-NS_CLASS_AVAILABLE(10_6, 4_0)
+@:framework("Foundation")
+@:require(osx10_6)
+@:require(ios4)
 extern class NSBlockOperation extends NSOperation {
-@private
-    id _private2;
-    void *_reserved2;
-}
 
-#if NS_BLOCKS_AVAILABLE
-+ (id)blockOperationWithBlock:(void (^)(void))block;
-
-public function addExecutionBlock:(void (^)(void))block;
-- (Array<> *)executionBlocks;
-#endif
+	public static function blockOperationWithBlock (block:Void->Void) :NSBlockOperation;
 
+	public function addExecutionBlock (block:Void->Void) :Void;
+	public function executionBlocks () :Array<Void->Void>;
 }
 
-
+@:framework("Foundation")
 extern class NSInvocationOperation extends NSOperation {
-@private
-    id _inv;
-    id _exception;
-    void *_reserved2;
-}
 
-- (id)initWithTarget:(id)target selector:(SEL)sel object:(id)arg;
-- (id)initWithInvocation:(NSInvocation *)inv;		// designated initializer
+	@:require(osx10_5) @:require(ios2) public static var NSInvocationOperationVoidResultException :String;
+	@:require(osx10_5) @:require(ios2) public static var NSInvocationOperationCancelledException :String;
 
-- (NSInvocation *)invocation;
+	public function initWithTarget (target:Dynamic, selector:SEL, object:Dynamic) :NSInvocationOperation;
+	public function initWithInvocation (inv:Dynamic) :NSInvocationOperation; // designated initializer
 
-- (id)result;
+	public function invocation () :Dynamic;
 
+	public function result () :Dynamic;
 }
 
-FOUNDATION_EXPORT NSString * const NSInvocationOperationVoidResultException NS_AVAILABLE(10_5, 2_0);
-FOUNDATION_EXPORT NSString * const NSInvocationOperationCancelledException NS_AVAILABLE(10_5, 2_0);
-
+/* Each queue runs its ready operations on threads taken from a shared pool
+   sized to the machine. Leave maxConcurrentOperationCount at the default
+   for CPU-bound work such as image decoding; lower it for queues whose
+   operations block on I/O or a shared resource, so they do not tie up
+   threads the other queues could use. */
 
+@:framework("Foundation")
 extern class NSOperationQueue extends NSObject {
 
-public function addOperation:(NSOperation *)op;
-public function addOperations:(Array<> *)ops waitUntilFinished:(Bool)wait NS_AVAILABLE(10_6, 4_0);
-
-#if NS_BLOCKS_AVAILABLE
-public function addOperationWithBlock:(void (^)(void))block NS_AVAILABLE(10_6, 4_0);
-#endif
+	//Constants
+	inline public static var NSOperationQueueDefaultMaxConcurrentOperationCount = -1;
 
-- (Array<> *)operations;
-- (NSUInteger)operationCount NS_AVAILABLE(10_6, 4_0);
+	//Static Methods
+	@:require(osx10_6) @:require(ios4) public static function currentQueue () :NSOperationQueue;
+	@:require(osx10_6) @:require(ios4) public static function mainQueue () :NSOperationQueue;
 
-- (Int)maxConcurrentOperationCount;
-public function setMaxConcurrentOperationCount:(Int)cnt;
+	//Methods
+	public function addOperation (op:NSOperation) :Void;
+	@:require(osx10_6) @:require(ios4) public function addOperations (ops:Array<NSOperation>, waitUntilFinished:Bool) :Void;
+	@:require(osx10_6) @:require(ios4) public function addOperationWithBlock (block:Void->Void) :Void;
 
-enum {
-    NSOperationQueueDefaultMaxConcurrentOperationCount = -1
-};
+	public function operations () :Array<NSOperation>;
+	@:require(osx10_6) @:require(ios4) public function operationCount () :Int;
 
-public function setSuspended:(Bool)b;
-- (Bool)isSuspended;
+	public function maxConcurrentOperationCount () :Int;
+	public function setMaxConcurrentOperationCount (cnt:Int) :Void;
 
-public function setName:(NSString *)n NS_AVAILABLE(10_6, 4_0);
-- (NSString *)name NS_AVAILABLE(10_6, 4_0);
+	public function setSuspended (b:Bool) :Void;
+	public function isSuspended () :Bool;
 
-public function cancelAllOperations;
+	@:require(osx10_6) @:require(ios4) public function setName (n:String) :Void;
+	@:require(osx10_6) @:require(ios4) public function name () :String;
 
-public function waitUntilAllOperationsAreFinished;
-
-+ (id)currentQueue NS_AVAILABLE(10_6, 4_0);
-+ (id)mainQueue NS_AVAILABLE(10_6, 4_0);
+	public function cancelAllOperations () :Void;
 
+	// Blocks the calling thread; never call it on the main thread or from
+	// an operation running on the same queue.
+	public function waitUntilAllOperationsAreFinished () :Void;
 }
-
-
-
@@ -1,5 +1,7 @@
 package swift.foundation;
 
+import swift.foundation.NSObject;
+
 extern enum NSRegularExpressionOptions {
    NSRegularExpressionCaseInsensitive;     /* Match letters in the pattern independent of case. */
    NSRegularExpressionAllowCommentsAndWhitespace;     /* Ignore whitespace and #-prefixed comments in the pattern. */
@@ -26,7 +28,17 @@ extern enum NSMatchingFlags {
    NSMatchingInternalError;/* Set when matching failed due to an internal error. */
 }
 
-@:require(osx_10_7)
+/* Compiling a pattern is far more expensive than running it, and compiled
+   expressions are immutable and safe to share between threads, so build
+   each one once and keep it rather than calling regularExpressionWithPattern
+   per use. Scanning a line against many patterns is usually faster with the
+   patterns joined into one alternation than with one pass per pattern, and
+   a cheap literal test (rangeOfString) in front of a rarely matching
+   pattern skips the matcher for most lines. */
+
+@:framework("Foundation")
+@:require(osx10_7)
+@:require(ios4)
 extern class NSRegularExpression extends NSObject implements NSCopying implements NSCoding {
 
 	public static function regularExpressionWithPattern (pattern:String, options:NSRegularExpressionOptions, error:NSError) : NSRegularExpression;
@@ -44,7 +56,10 @@ extern class NSRegularExpression extends NSObject implements NSCopying implement
 	public function enumerateMatchesInString (string:String, options:NSMatchingOptions, range:NSRange, usingBlock:NSTextCheckingResult->NSMatchingFlags->Bool->Void) :Void;
 #end
 
-	public function matchesInString (string:String, options:NSMatchingOptions, range:NSRange) :Array<String>;
+	// When only the presence or position of a match matters, firstMatchInString
+	// and rangeOfFirstMatchInString stop at the first match instead of
+	// collecting every result.
+	public function matchesInString (string:String, options:NSMatchingOptions, range:NSRange) :Array<NSTextCheckingResult>;
 	public function numberOfMatchesInString (string:String, options:NSMatchingOptions, range:NSRange) :Int;
 	public function firstMatchInString (string:String, options:NSMatchingOptions, range:NSRange) : NSTextCheckingResult;
 	public function rangeOfFirstMatchInString (string:String, options:NSMatchingOptions, range:NSRange) :NSRange;
@@ -54,14 +69,16 @@ extern class NSRegularExpression extends NSObject implements NSCopying implement
 
 
 	public function stringByReplacingMatchesInString (string:String, options:NSMatchingOptions, range:NSRange, withTemplate:String) :String;
-	public function replaceMatchesInString (string:String, options:NSMatchingOptions, range:NSRange, withTemplate:String) :Int;
+	public function replaceMatchesInString (string:NSMutableString, options:NSMatchingOptions, range:NSRange, withTemplate:String) :Int;
 	public function replacementStringForResult (result:NSTextCheckingResult, inString:String, offset:Int, template:String) :String;
 
 	public static function escapedTemplateForString (string:String) :String;
 
 }
 
-@:require(10_7, 4_0)
+@:framework("Foundation")
+@:require(osx10_7)
+@:require(ios4)
 extern class NSDataDetector extends NSRegularExpression {
 
 	public static function dataDetectorWithTypes (checkingTypes:NSTextCheckingTypes, error:NSError) : NSDataDetector;
@@ -1,90 +1,65 @@
-package swift.foundation;
+/*	NSScanner.h
+	Copyright (c) 1994-2012, Apple Inc. All rights reserved.
+*/
 
+package swift.foundation;
 
-extern class NSScanner implements NSCopying
+import swift.foundation.NSObject;
+
+/* Every scan call first skips charactersToBeSkipped (whitespace and
+   newlines by default), then matches from scanLocation. Passing null as the
+   value of the string scanning methods only advances the location, which
+   avoids creating a substring for fields that are skipped. For line based
+   input such as CSV, scan one line with scanUpToCharactersFromSet and the
+   newline set, then split the fields with a scanner over that line or with
+   componentsSeparatedByString; build the NSCharacterSet arguments once
+   outside the loop. scannerWithString parses numbers in the POSIX format,
+   which is faster than localizedScannerWithString and what machine written
+   files use. */
+
+@:framework("Foundation")
+extern class NSScanner extends NSObject implements NSCopying
 {
 
 	//Constants
 
 	//Static Methods
-	public function scannerWithString( string:String):Dynamic;
-	public function localizedScannerWithString( string:String):Dynamic;
+	public static function scannerWithString( string:String):Dynamic;
+	public static function localizedScannerWithString( string:String):Dynamic;
 
 	//Properties
 
 	//Methods
-	public function scanLongLong( value:longlong):Bool;
-	public function setCaseSensitive( flag:Bool):Void;
-	public function scanInt( value:int):Bool;
-	public function scanHexLongLong( result:unsignedlonglong):Bool;
-	public function scanInteger( value:Int):Bool;
-	public function scanHexDouble( result:double):Bool;
-	public function scanFloat( value:float):Bool;
-	public function scanCharactersFromSet( set:NSCharacterSet,  value:NSString*):Bool;
-	public function string():String;
-	public function setScanLocation( pos:Int):Void;
-	public function scanHexFloat( result:float):Bool;
-	public function locale():Dynamic;
-	public function scanUpToString( string:String,  value:NSString*):Bool;
 	public function initWithString( string:String):Dynamic;
+
+	public function string():String;
 	public function scanLocation():Int;
+	public function setScanLocation( pos:Int):Void;
 	public function setCharactersToBeSkipped( set:NSCharacterSet):Void;
-	public function setLocale( locale:Dynamic):Void;
 	public function charactersToBeSkipped():NSCharacterSet;
-	public function scanDouble( value:double):Bool;
-	public function isAtEnd():Bool;
-	public function scanHexInt( value:unsigned):Bool;
-	public function scanUpToCharactersFromSet( set:NSCharacterSet,  value:NSString*):Bool;
+	public function setCaseSensitive( flag:Bool):Void;
 	public function caseSensitive():Bool;
-	public function scanString( string:String,  value:NSString*):Bool;
-}
-
-/*	NSScanner.h
-	Copyright (c) 1994-2012, Apple Inc. All rights reserved.
-*/
-
-package swift.foundation;
-
-@class NSString, NSCharacterSet, NSDictionary;
-
-extern class NSScanner extends NSObject implements NSCopying>
-
-- (NSString *)string;
-- (NSUInteger)scanLocation;
-public function setScanLocation:(NSUInteger)pos;
-public function setCharactersToBeSkipped:(NSCharacterSet *)set;
-public function setCaseSensitive:(Bool)flag;
-public function setLocale:(id)locale;
-
-}
-
-extern class NSScanner (NSExtendedScanner)
-
-- (NSCharacterSet *)charactersToBeSkipped;
-- (Bool)caseSensitive;
-- (id)locale;
-
-- (Bool)scanInt:(int *)value;
-- (Bool)scanInteger:(Int *)value NS_AVAILABLE(10_5, 2_0);
-- (Bool)scanHexLongLong:(unsigned long long *)result NS_AVAILABLE(10_5, 2_0);
-- (Bool)scanHexFloat:(float *)result NS_AVAILABLE(10_5, 2_0);		// Corresponding to %a or %A formatting. Requires "0x" or "0X" prefix. 
-- (Bool)scanHexDouble:(double *)result NS_AVAILABLE(10_5, 2_0);		// Corresponding to %a or %A formatting. Requires "0x" or "0X" prefix. 
-- (Bool)scanHexInt:(unsigned *)value;		// Optionally prefixed with "0x" or "0X"
-- (Bool)scanLongLong:(long long *)value;
-- (Bool)scanFloat:(float *)value;
-- (Bool)scanDouble:(double *)value;
-
-- (Bool)scanString:(NSString *)string intoString:(NSString **)value;
-- (Bool)scanCharactersFromSet:(NSCharacterSet *)set intoString:(NSString **)value;
-
-- (Bool)scanUpToString:(NSString *)string intoString:(NSString **)value;
-- (Bool)scanUpToCharactersFromSet:(NSCharacterSet *)set intoString:(NSString **)value;
-
-- (Bool)isAtEnd;
+	public function setLocale( locale:Dynamic):Void;
+	public function locale():Dynamic;
 
-- (id)initWithString:(NSString *)string;
-+ (id)scannerWithString:(NSString *)string;
-+ (id)localizedScannerWithString:(NSString *)string;
+	public function scanInt( value:Int):Bool;
+	@:require(osx10_5) @:require(ios2) public function scanInteger( value:Int):Bool;
+	@:require(osx10_5) @:require(ios2) public function scanHexLongLong( result:Int):Bool;
+	// Corresponding to %a or %A formatting. Requires "0x" or "0X" prefix.
+	@:require(osx10_5) @:require(ios2) public function scanHexFloat( result:Float):Bool;
+	// Corresponding to %a or %A formatting. Requires "0x" or "0X" prefix.
+	@:require(osx10_5) @:require(ios2) public function scanHexDouble( result:Float):Bool;
+	// Optionally prefixed with "0x" or "0X"
+	public function scanHexInt( value:Int):Bool;
+	public function scanLongLong( value:Int):Bool;
+	public function scanFloat( value:Float):Bool;
+	public function scanDouble( value:Float):Bool;
+
+	public function scanString( string:String,  value:String):Bool;
+	public function scanCharactersFromSet( set:NSCharacterSet,  value:String):Bool;
+
+	public function scanUpToString( string:String,  value:String):Bool;
+	public function scanUpToCharactersFromSet( set:NSCharacterSet,  value:String):Bool;
 
+	public function isAtEnd():Bool;
 }
-
@@ -51,6 +51,9 @@ public function enumerateObjectsWithOptions:(NSEnumerationOptions)opts usingBloc
 	public function initWithSet (set:NSSet) :NSSet;
 	public function initWithArray (objs:Array<Dynamic>) :NSSet;
 
+	@:require(osx10_6) @:require(ios4) public function sortedArrayUsingDescriptors (sortDescriptors:Array<NSSortDescriptor>) :Array<Dynamic>;
+	@:require(osx10_5) @:require(ios3) public function filteredSetUsingPredicate (predicate:NSPredicate) :NSSet;
+
 }
 
 @:framework("Foundation")
@@ -69,6 +72,8 @@ extern class NSMutableSet extends NSSet {
 
 	public function setSet (otherSet:NSSet) :Void;
 
+	@:require(osx10_5) @:require(ios3) public function filterUsingPredicate (predicate:NSPredicate) :Void;
+
 //extern class NSMutableSet (NSMutableSetCreation)
 
 	public static function setWithCapacity (numItems:Int) :NSMutableSet;
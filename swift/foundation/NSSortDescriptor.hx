@@ -1,94 +1,54 @@
+/*
+	NSSortDescriptor.h
+	Foundation
+	Copyright (c) 2002-2012, Apple Inc. All rights reserved.
+*/
+
 package swift.foundation;
 
+import swift.foundation.NSObject;
 
-extern class NSSortDescriptor implements NSCoding implements NSCopying
+private typedef NSComparator = Dynamic;
+
+/* A key path is resolved through key-value coding on both objects at
+   every comparison, so sorting n objects on k descriptors does on the order
+   of n log n * k lookups. For large arrays sorted on several keys, resolve
+   the keys once (for example into a wrapper object or parallel arrays of
+   values and indexes), sort those with sortedArrayUsingComparator, and use
+   the result to order the model objects. The first descriptor is the
+   primary key and later ones only break its ties, so the order of the
+   descriptors must follow the ordering the caller needs. */
+
+@:framework("Foundation")
+extern class NSSortDescriptor extends NSObject implements NSCoding implements NSCopying
 {
 
 	//Constants
 
 	//Static Methods
-	public function sortDescriptorWithKey( key:String,  ascending:Bool):Dynamic;
+	@:require(osx10_6) @:require(ios4) public static function sortDescriptorWithKey( key:String,  ascending:Bool):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function sortDescriptorWithKey1( key:String,  ascending:Bool,  selector:SEL):Dynamic;
+	@:require(osx10_6) @:require(ios4) public static function sortDescriptorWithKey1( key:String,  ascending:Bool,  selector:SEL):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function sortDescriptorWithKey2( key:String,  ascending:Bool,  cmptr:NSComparator):Dynamic;
+	@:require(osx10_6) @:require(ios4) public static function sortDescriptorWithKey2( key:String,  ascending:Bool,  cmptr:NSComparator):Dynamic;
 
 	//Properties
 
 	//Methods
-	public function selector():SEL;
-	public function compareObject( object1:Dynamic,  object2:Dynamic):NSComparisonResult;
-	public function comparator():NSComparator;
-	public function sortedArrayUsingDescriptors( sortDescriptors:Array<>):Array<>;
-	//@:overload !!NEED CUSTOM META DATA !!
-	public function sortedArrayUsingDescriptors1( sortDescriptors:Array<>):Array<>;
-	public function sortUsingDescriptors( sortDescriptors:Array<>):Void;
+	// keys may be key paths
 	public function initWithKey( key:String,  ascending:Bool):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
 	public function initWithKey1( key:String,  ascending:Bool,  selector:SEL):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function initWithKey2( key:String,  ascending:Bool,  cmptr:NSComparator):Dynamic;
+	@:require(osx10_6) @:require(ios4) public function initWithKey2( key:String,  ascending:Bool,  cmptr:NSComparator):Dynamic;
+
 	public function key():String;
 	public function ascending():Bool;
-	public function reversedSortDescriptor():Dynamic;
-}
-
-/*
-	NSSortDescriptor.h
-	Foundation
-	Copyright (c) 2002-2012, Apple Inc. All rights reserved.
-*/
-
-#import <Foundation/Array<>.h>
-#import <Foundation/NSSet.h>
-
-
-extern class NSSortDescriptor extends NSObject implements NSObject, NSCopying> {
-@private
-    NSUInteger _sortDescriptorFlags;
-    NSString *_key;
-    SEL _selector;
-    id _selectorOrBlock;
-}
-
-+ (id)sortDescriptorWithKey:(NSString *)key ascending:(Bool)ascending NS_AVAILABLE(10_6, 4_0);
-+ (id)sortDescriptorWithKey:(NSString *)key ascending:(Bool)ascending selector:(SEL)selector NS_AVAILABLE(10_6, 4_0);
-
-// keys may be key paths
-- (id)initWithKey:(NSString *)key ascending:(Bool)ascending;
-- (id)initWithKey:(NSString *)key ascending:(Bool)ascending selector:(SEL)selector;
-
-- (NSString *)key;
-- (Bool)ascending;
-- (SEL)selector;
-
-#if NS_BLOCKS_AVAILABLE
-+ (id)sortDescriptorWithKey:(NSString *)key ascending:(Bool)ascending comparator:(NSComparator)cmptr NS_AVAILABLE(10_6, 4_0);
-
-- (id)initWithKey:(NSString *)key ascending:(Bool)ascending comparator:(NSComparator)cmptr NS_AVAILABLE(10_6, 4_0);
-- (NSComparator)comparator NS_AVAILABLE(10_6, 4_0);
-#endif
-
-- (NSComparisonResult)compareObject:(id)object1 toObject:(id)object2;    // primitive - override this method if you want to perform comparisons differently (not key based for example)
-- (id)reversedSortDescriptor;    // primitive - override this method to return a sort descriptor instance with reversed sort order
-
-}
-
-extern class NSSet (NSSortDescriptorSorting)
-
-- (Array<> *)sortedArrayUsingDescriptors:(Array<> *)sortDescriptors NS_AVAILABLE(10_6, 4_0);    // returns a new array by sorting the objects of the receiver
-
-}
-
-extern class Array<> (NSSortDescriptorSorting)
-
-- (Array<> *)sortedArrayUsingDescriptors:(Array<> *)sortDescriptors;    // returns a new array by sorting the objects of the receiver
-
-}
-
-extern class NSMutableArray (NSSortDescriptorSorting)
-
-public function sortUsingDescriptors:(Array<> *)sortDescriptors;    // sorts the array itself
+	public function selector():SEL;
+	@:require(osx10_6) @:require(ios4) public function comparator():NSComparator;
 
+	// primitive - override this method if you want to perform comparisons differently (not key based for example)
+	public function compareObject( object1:Dynamic,  object2:Dynamic):NSComparisonResult;
+	// primitive - override this method to return a sort descriptor instance with reversed sort order
+	public function reversedSortDescriptor():Dynamic;
 }
-
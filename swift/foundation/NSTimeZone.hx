@@ -1,6 +1,6 @@
 package swift.foundation;
 import swift.foundation.NSObject;
-private typedef NSTimeInterval = Int;
+private typedef NSTimeInterval = Float;
 
 @:framework("Foundation")
 extern class NSTimeZone extends NSObject implements NSCopying implements NSSecureCoding {
@@ -8,20 +8,24 @@ extern class NSTimeZone extends NSObject implements NSCopying implements NSSecur
 	//Constants
 
 	//Static Methods
-	public function defaultTimeZone() :NSTimeZone;
-	public function knownTimeZoneNames() :Array<NSTimeZone>;
-	public function timeZoneDataVersion():String;
-	public function localTimeZone():NSTimeZone;
-	public function resetSystemTimeZone():Void;
-	public function timeZoneWithName( tzName:String):Dynamic;
+	@:require(osx10_5)
+	@:require(ios2)
+	public static var NSSystemTimeZoneDidChangeNotification :String;
+
+	public static function defaultTimeZone() :NSTimeZone;
+	public static function knownTimeZoneNames() :Array<String>;
+	public static function timeZoneDataVersion():String;
+	public static function localTimeZone():NSTimeZone;
+	public static function resetSystemTimeZone():Void;
+	public static function timeZoneWithName( tzName:String):Dynamic;
 	//@:overload !!NEED CUSTOM META DATA !!
-	public function timeZoneWithName1( tzName:String,  aData:NSData):Dynamic;
-	public function abbreviationDictionary():NSDictionary;
-	public function timeZoneForSecondsFromGMT( seconds:Int):Dynamic;
-	public function systemTimeZone():NSTimeZone;
-	public function setDefaultTimeZone( aTimeZone:NSTimeZone):Void;
-	public function setAbbreviationDictionary( dict:NSDictionary):Void;
-	public function timeZoneWithAbbreviation( abbreviation:String):Dynamic;
+	public static function timeZoneWithName1( tzName:String,  aData:NSData):Dynamic;
+	public static function abbreviationDictionary():NSDictionary;
+	public static function timeZoneForSecondsFromGMT( seconds:Int):Dynamic;
+	public static function systemTimeZone():NSTimeZone;
+	public static function setDefaultTimeZone( aTimeZone:NSTimeZone):Void;
+	public static function setAbbreviationDictionary( dict:NSDictionary):Void;
+	public static function timeZoneWithAbbreviation( abbreviation:String):Dynamic;
 
 	//Properties
 
@@ -29,6 +33,8 @@ extern class NSTimeZone extends NSObject implements NSCopying implements NSSecur
 	public function name():String;
 	public function daylightSavingTimeOffset():NSTimeInterval;
 	public function nextDaylightSavingTimeTransition():Date;
+	// The offset holds until nextDaylightSavingTimeTransitionAfterDate, so
+	// ascending runs of dates only need a new lookup past that date.
 	public function secondsFromGMTForDate( aDate:Date):Int;
 	public function abbreviationForDate( aDate:Date):String;
 	public function isDaylightSavingTimeForDate( aDate:Date):Bool;
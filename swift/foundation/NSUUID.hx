@@ -18,7 +18,7 @@ extern class NSUUID extends NSObject implements NSCopying implements NSSecureCod
 /* Create an NSUUID from a string such as "E621E1F8-C36C-495A-93FC-0C247A3E6E5F". Returns nil for invalid strings. */
 	public function initWithUUIDString (string:String) :NSUUID;
 
-/* Create an NSUUID with the given bytes */
+/* Create an NSUUID with the given bytes. Together with getUUIDBytes this avoids formatting and parsing the string form when storing identifiers */
 	public function initWithUUIDBytes (bytes:Dynamic) :NSUUID;
 
 /* Get the individual bytes of the receiver */
@@ -28,6 +28,4 @@ extern class NSUUID extends NSObject implements NSCopying implements NSSecureCod
 	public function UUIDString () :String;
 
 }
-
-#end
 	
\ No newline at end of file
@@ -1,8 +1,12 @@
 package swift.foundation;
 
+import swift.foundation.NSObject;
 
+@:framework("Foundation")
 extern class NSUserDefaults extends NSObject {
 
+	public static var NSUserDefaultsDidChangeNotification :String;
+
 	public static function standardUserDefaults() :NSUserDefaults;
 	public static function resetStandardUserDefaults() :Void;
 
@@ -48,6 +52,9 @@ extern class NSUserDefaults extends NSObject {
 	public function setPersistentDomain (domain:NSDictionary, forName:String) :Void;
 	public function removePersistentDomainForName (domainName:String) :Void;
 	
+	// Setters update the in-memory domain and the defaults are written out
+	// periodically on their own, one whole plist per write. Call synchronize
+	// only where the values must be on disk now, never once per set.
 	public function synchronize() :Bool;
 	
 	public function objectIsForcedForKey (key:String) :Bool;